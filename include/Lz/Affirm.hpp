@@ -15,10 +15,6 @@ namespace lz {
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
         using FunctionReturnType = detail::FunctionReturnType<Function, decltype(*std::declval<Iterator>())>;
         static_assert(std::is_same<FunctionReturnType, bool>::value, "function predicate must return bool");
 
@@ -32,28 +28,12 @@ namespace lz {
          * `exception` is thrown.
          */
         Affirm(const Iterator begin, const Iterator end, Exception&& exception, const Function& predicate) :
-            _begin(begin, predicate, exception),
-    		_end(end, predicate, std::forward<Exception>(exception)) {
+            detail::BasicIteratorView<iterator>(iterator(begin, predicate, exception),
+                                                iterator(end, predicate, exception)) {
         }
     	
 
         Affirm() = default;
-
-        /**
-         * @brief Returns the beginning of the sequence.
-         * @return The beginning of the sequence.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * @brief Returns the ending of the sequence.
-         * @return The ending of the sequence.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
     /**
     * @addtogroup ItFns
@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef LZ_ASYNC_MAP_HPP
+#define LZ_ASYNC_MAP_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/AsyncMapIterator.hpp"
+
+
+namespace lz {
+    template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+    class AsyncMap final : public detail::BasicIteratorView<detail::AsyncMapIterator<Iterator, Function>> {
+    public:
+        using iterator = detail::AsyncMapIterator<Iterator, Function>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        using State = detail::AsyncMapState<Iterator, Function>;
+
+    public:
+        /**
+         * @brief Creates a view that calls `function` on a pool of its own.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param function A function that takes a value type as parameter.
+         * @param workers The amount of threads of the pool.
+         * @param window The maximum amount of elements that are being calculated or waiting to be read.
+         */
+        AsyncMap(const Iterator begin, const Iterator end, const Function& function, const std::size_t workers,
+                 const std::size_t window) :
+            detail::BasicIteratorView<iterator>(iterator(std::make_shared<State>(begin, end, function, workers, window)), iterator()) {
+        }
+
+        /**
+         * @brief Creates a view that calls `function` on `pool`.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param function A function that takes a value type as parameter.
+         * @param pool The pool to use. Must outlive the view.
+         * @param window The maximum amount of elements that are being calculated or waiting to be read.
+         */
+        AsyncMap(const Iterator begin, const Iterator end, const Function& function, ThreadPool& pool, const std::size_t window) :
+            detail::BasicIteratorView<iterator>(iterator(std::make_shared<State>(begin, end, function, pool, window)), iterator()) {
+        }
+
+        AsyncMap() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a view that calls `function` for every element on a pool of `workers` threads, and yields the
+     * results in the order of the sequence. At most `window` elements are submitted ahead of the element that is read,
+     * so the memory that is used stays bounded. Use it instead of `lz::map` if `function` is slow, e.g. parsing or
+     * hashing, and the elements are independent.
+     * @details The elements are read from [begin, end) on the thread that iterates the view and copied to the task, so
+     * the sequence itself does not need to be thread safe, but `function` is called concurrently. The view can be
+     * iterated once. If `function` throws, the exception is rethrown when its result is read.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Function Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param function A function that takes a value type as parameter.
+     * @param workers The amount of threads of the pool that is created for this view.
+     * @param window The maximum amount of elements that are being calculated or waiting to be read. 0 means twice the
+     * amount of threads.
+     * @return An input view over the results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+    AsyncMap<Iterator, Function>
+    asyncMapRange(const Iterator begin, const Iterator end, const Function& function,
+                  const std::size_t workers = ThreadPool::defaultThreadCount(), const std::size_t window = 0) {
+        return AsyncMap<Iterator, Function>(begin, end, function, workers, window);
+    }
+
+    /**
+     * @brief Returns a view that calls `function` for every element on `pool`, and yields the results in the order of
+     * the sequence. At most `window` elements are submitted ahead of the element that is read, so the memory that is
+     * used stays bounded. Sharing one pool between pipelines keeps the amount of threads under control.
+     * @details The elements are read from [begin, end) on the thread that iterates the view and copied to the task, so
+     * the sequence itself does not need to be thread safe, but `function` is called concurrently. The view can be
+     * iterated once. If `function` throws, the exception is rethrown when its result is read.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Function Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param function A function that takes a value type as parameter.
+     * @param pool The pool to use. Must outlive the view.
+     * @param window The maximum amount of elements that are being calculated or waiting to be read. 0 means twice the
+     * amount of threads.
+     * @return An input view over the results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+    AsyncMap<Iterator, Function>
+    asyncMapRange(const Iterator begin, const Iterator end, const Function& function, ThreadPool& pool, const std::size_t window = 0) {
+        return AsyncMap<Iterator, Function>(begin, end, function, pool, window);
+    }
+
+    /**
+     * @brief Returns a view that calls `function` for every element on a pool of `workers` threads, and yields the
+     * results in the order of the sequence, e.g. `lz::asyncMap(files, decompress, 4, 16)`. At most `window` elements
+     * are submitted ahead of the element that is read, so the memory that is used stays bounded.
+     * @details The elements are read from `iterable` on the thread that iterates the view and copied to the task, so
+     * the sequence itself does not need to be thread safe, but `function` is called concurrently. The view can be
+     * iterated once. If `function` throws, the exception is rethrown when its result is read.
+     * @tparam Function Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to map.
+     * @param function A function that takes a value type as parameter.
+     * @param workers The amount of threads of the pool that is created for this view.
+     * @param window The maximum amount of elements that are being calculated or waiting to be read. 0 means twice the
+     * amount of threads.
+     * @return An input view over the results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+    AsyncMap<detail::IterType<Iterable>, Function>
+    asyncMap(Iterable&& iterable, const Function& function, const std::size_t workers = ThreadPool::defaultThreadCount(),
+             const std::size_t window = 0) {
+        return asyncMapRange(std::begin(iterable), std::end(iterable), function, workers, window);
+    }
+
+    /**
+     * @brief Returns a view that calls `function` for every element on `pool`, and yields the results in the order of
+     * the sequence, e.g. `lz::asyncMap(files, decompress, pool, 16)`. At most `window` elements are submitted ahead of
+     * the element that is read, so the memory that is used stays bounded.
+     * @details The elements are read from `iterable` on the thread that iterates the view and copied to the task, so
+     * the sequence itself does not need to be thread safe, but `function` is called concurrently. The view can be
+     * iterated once. If `function` throws, the exception is rethrown when its result is read.
+     * @tparam Function Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to map.
+     * @param function A function that takes a value type as parameter.
+     * @param pool The pool to use. Must outlive the view.
+     * @param window The maximum amount of elements that are being calculated or waiting to be read. 0 means twice the
+     * amount of threads.
+     * @return An input view over the results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+    AsyncMap<detail::IterType<Iterable>, Function>
+    asyncMap(Iterable&& iterable, const Function& function, ThreadPool& pool, const std::size_t window = 0) {
+        return asyncMapRange(std::begin(iterable), std::end(iterable), function, pool, window);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
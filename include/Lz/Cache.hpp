@@ -0,0 +1,93 @@
+#pragma once
+
+#ifndef LZ_CACHE_HPP
+#define LZ_CACHE_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/CacheIterator.hpp"
+
+
+namespace lz {
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    class Cache final : public detail::BasicIteratorView<detail::CacheIterator<Iterator>> {
+    public:
+        using iterator = detail::CacheIterator<Iterator>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        using Storage = detail::CacheStorage<value_type>;
+
+        Cache(const Iterator begin, const Iterator end, const std::size_t endIndex, const std::shared_ptr<Storage>& storage) :
+            detail::BasicIteratorView<iterator>(iterator(begin, 0, storage), iterator(end, endIndex, storage)) {
+        }
+
+        Cache(const Iterator begin, const Iterator end, const std::size_t size, const std::size_t window) :
+            Cache(begin, end, size, std::make_shared<Storage>(detail::IsRandomAccess<Iterator>::value ? size : window)) {
+        }
+
+    public:
+        /**
+         * @brief Creates a view that stores every element of [begin, end) the first time it is dereferenced.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param window The amount of elements that are remembered if the iterator is not random access. Otherwise, all
+         * elements are remembered.
+         */
+        Cache(const Iterator begin, const Iterator end, const std::size_t window) :
+            Cache(begin, end, detail::IsRandomAccess<Iterator>::value ? static_cast<std::size_t>(std::distance(begin, end)) : 0,
+                  window) {
+        }
+
+        Cache() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a view that evaluates every element of [begin, end) at most once, by storing it the first time it
+     * is dereferenced. Use it to wrap views that are expensive to dereference, e.g. a map with a parsing function,
+     * before passing them to views or algorithms that dereference the same element more than once.
+     * @details If the iterator is random access, all elements are stored. Otherwise, the last `window` elements are
+     * stored, and the iterator yields copies of them, because the slot of an element is reused `window` elements later.
+     * Copies of this view share the stored elements, and dereferencing is not thread safe.
+     * @tparam Iterator Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param window The amount of elements that are remembered if the iterator is not random access.
+     * @return A view over [begin, end) that yields const references to the stored elements if the iterator is random
+     * access, and copies of them otherwise. It is random access if the iterator is random access, forward otherwise.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    Cache<Iterator> cacheRange(const Iterator begin, const Iterator end, const std::size_t window = 64) {
+        return Cache<Iterator>(begin, end, window);
+    }
+
+    /**
+     * @brief Returns a view that evaluates every element of `iterable` at most once, by storing it the first time it is
+     * dereferenced, e.g. `lz::cache(lz::map(lines, parse))` parses every line once, however often it is read.
+     * @details If the iterator is random access, all elements are stored. Otherwise, the last `window` elements are
+     * stored, and the iterator yields copies of them, because the slot of an element is reused `window` elements later.
+     * Copies of this view share the stored elements, and dereferencing is not thread safe.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to cache.
+     * @param window The amount of elements that are remembered if the iterator is not random access.
+     * @return A view over `iterable` that yields const references to the stored elements if the iterator is random
+     * access, and copies of them otherwise. It is random access if the iterator is random access, forward otherwise.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable>
+    Cache<detail::IterType<Iterable>> cache(Iterable&& iterable, const std::size_t window = 64) {
+        return cacheRange(std::begin(iterable), std::end(iterable), window);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
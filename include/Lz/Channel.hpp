@@ -0,0 +1,260 @@
+#pragma once
+
+#ifndef LZ_CHANNEL_HPP
+#define LZ_CHANNEL_HPP
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/ChannelIterator.hpp"
+
+
+namespace lz {
+    template<class T>
+    class Channel final : public detail::BasicIteratorView<detail::ChannelIterator<T>> {
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+                      "the elements of lz::Channel are moved into claimed slots, so moving them must not throw");
+
+    public:
+        using iterator = detail::ChannelIterator<T>;
+        using const_iterator = iterator;
+        using value_type = T;
+
+    private:
+        using State = detail::ChannelState<T>;
+        using Cursor = detail::ChannelCursor<T>;
+
+        std::shared_ptr<State> _state{};
+
+        // Every channel object reads through a cursor of its own, so that copies can be read by different threads
+        void setIterators() {
+            this->_begin = _state == nullptr ? iterator() : iterator(std::make_shared<Cursor>(_state));
+            this->_end = iterator();
+        }
+
+        explicit Channel(std::shared_ptr<State> state) :
+            _state(std::move(state)) {
+            setIterators();
+        }
+
+        bool popInto(T& value, const bool wait) {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type slot;
+            T* element = reinterpret_cast<T*>(&slot);
+            const auto moveToSlot = [element](T& popped) {
+                ::new(static_cast<void*>(element)) T(std::move(popped));
+            };
+            if ((wait ? _state->pop(moveToSlot, 1) : _state->tryPop(moveToSlot, 1)) == 0) {
+                return false;
+            }
+            try {
+                value = std::move(*element);
+            }
+            catch (...) {
+                element->~T();
+                throw;
+            }
+            element->~T();
+            return true;
+        }
+
+    public:
+        /**
+         * @brief Creates a channel that holds at most `capacity` elements.
+         * @param capacity The maximum amount of elements that are pushed but not popped. At least 2.
+         */
+        explicit Channel(const std::size_t capacity) :
+            Channel(std::make_shared<State>(capacity)) {
+        }
+
+        /**
+         * @brief Copies the channel object. The copy pushes to and pops from the same channel, but is read through a
+         * position of its own, so that every consumer thread can iterate its own copy.
+         * @param other The channel object to copy.
+         */
+        Channel(const Channel& other) :
+            Channel(other._state) {
+        }
+
+        Channel& operator=(const Channel& other) {
+            _state = other._state;
+            setIterators();
+            return *this;
+        }
+
+        Channel(Channel&&) = default;
+
+        Channel& operator=(Channel&&) = default;
+
+        Channel() = default;
+
+        /**
+         * @brief Returns the maximum amount of elements that are pushed but not popped.
+         * @return The capacity of the channel.
+         */
+        std::size_t capacity() const {
+            return _state->capacity();
+        }
+
+        /**
+         * @brief Closes the channel. Pushes fail from then on, and consumers stop once the elements that were pushed
+         * before are popped.
+         */
+        void close() {
+            _state->close();
+        }
+
+        /**
+         * @brief Checks whether the channel is closed.
+         * @return `true` if `close` has been called, `false` otherwise.
+         */
+        bool isClosed() const {
+            return _state->isClosed();
+        }
+
+        /**
+         * @brief Pushes a copy of `value`, waiting for room while the channel is full.
+         * @param value The element to push.
+         * @return `true` if the element was pushed, `false` if the channel is closed.
+         */
+        bool push(const T& value) {
+            T copy(value);
+            return push(std::move(copy));
+        }
+
+        /**
+         * @brief Moves `value` into the channel, waiting for room while the channel is full.
+         * @param value The element to push. Only moved from if it is pushed.
+         * @return `true` if the element was pushed, `false` if the channel is closed.
+         */
+        bool push(T&& value) {
+            return _state->push(&value, 1) == 1;
+        }
+
+        /**
+         * @brief Pushes a copy of `value` if there is room.
+         * @param value The element to push.
+         * @return `true` if the element was pushed, `false` if the channel is full or closed.
+         */
+        bool tryPush(const T& value) {
+            T copy(value);
+            return tryPush(std::move(copy));
+        }
+
+        /**
+         * @brief Moves `value` into the channel if there is room.
+         * @param value The element to push. Only moved from if it is pushed.
+         * @return `true` if the element was pushed, `false` if the channel is full or closed.
+         */
+        bool tryPush(T&& value) {
+            return _state->tryPush(&value, 1) == 1;
+        }
+
+        /**
+         * @brief Pushes the elements of [begin, end), waiting for room while the channel is full. The elements are read
+         * in batches of at most `capacity()` elements, and every batch claims its slots at once where there is room.
+         * @param begin The beginning of the sequence to push.
+         * @param end The ending of the sequence to push.
+         * @return The amount of pushed elements. Less than the size of [begin, end) if the channel is closed.
+         */
+        template<LZ_CONCEPT_ITERATOR Iterator>
+        std::size_t pushBatch(Iterator begin, const Iterator end) {
+            // The batch is read before any slot is claimed, so that an exception of the sequence leaves no empty slot
+            std::vector<T> batch;
+            std::size_t pushed = 0;
+            while (begin != end) {
+                batch.clear();
+                for (; begin != end && batch.size() != capacity(); ++begin) {
+                    batch.emplace_back(*begin);
+                }
+                const std::size_t batchPushed = _state->push(batch.data(), batch.size());
+                pushed += batchPushed;
+                if (batchPushed != batch.size()) {
+                    break;
+                }
+            }
+            return pushed;
+        }
+
+        /**
+         * @brief Pushes the elements of `iterable`, waiting for room while the channel is full. The elements are read in
+         * batches of at most `capacity()` elements, and every batch claims its slots at once where there is room.
+         * @param iterable The sequence to push.
+         * @return The amount of pushed elements. Less than the size of `iterable` if the channel is closed.
+         */
+        template<LZ_CONCEPT_ITERABLE Iterable>
+        std::size_t pushBatch(Iterable&& iterable) {
+            return pushBatch(std::begin(iterable), std::end(iterable));
+        }
+
+        /**
+         * @brief Pops an element, waiting while the channel is empty and not closed.
+         * @param value The object to move the element into.
+         * @return `true` if an element was popped, `false` if the channel is closed and drained.
+         */
+        bool pop(T& value) {
+            return popInto(value, true);
+        }
+
+        /**
+         * @brief Pops an element if the channel is not empty.
+         * @param value The object to move the element into.
+         * @return `true` if an element was popped, `false` if the channel is empty.
+         */
+        bool tryPop(T& value) {
+            return popInto(value, false);
+        }
+
+        /**
+         * @brief Pops at most `max` elements that are pushed already, waiting while the channel is empty and not
+         * closed. The slots of the elements are claimed at once.
+         * @param output The output iterator to move the elements to.
+         * @param max The maximum amount of elements to pop.
+         * @return The amount of popped elements. 0 if the channel is closed and drained, or if `max` is 0.
+         */
+        template<class OutputIterator>
+        std::size_t popBatch(OutputIterator output, const std::size_t max) {
+            if (max == 0) {
+                return 0;
+            }
+            // Reserved up front, so that moving the elements out of their slots does not throw
+            const std::size_t count = std::min(max, capacity());
+            std::vector<T> popped;
+            popped.reserve(count);
+            _state->pop([&popped](T& element) { popped.push_back(std::move(element)); }, count);
+            std::move(popped.begin(), popped.end(), output);
+            return popped.size();
+        }
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a bounded channel of `T`, that any amount of threads can push to and pop from at the same time,
+     * without locking. Pushes wait while the channel is full and pops wait while it is empty, until the channel is
+     * closed. E.g. network handlers push requests while `for (auto& response : lz::map(requests, handle))` reads them.
+     * @details The channel is a view as well, that pops an element when it is read and ends once the channel is closed
+     * and drained. Copies of a channel share the elements, but every copy is read through a position of its own, so
+     * that multiple consumer threads each iterate a copy of their own. A channel object must not be read by multiple
+     * threads at the same time. Elements are popped as they are read, so `lz::take(channel, 10)` pops no more than 10.
+     * @tparam T The type of the elements. Moving it must not throw.
+     * @param capacity The maximum amount of elements that are pushed but not popped. At least 2.
+     * @return An empty, open channel.
+     */
+    template<class T>
+    Channel<T> channel(const std::size_t capacity = 1024) {
+        return Channel<T>(capacity);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
@@ -16,10 +16,6 @@ namespace lz {
 
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
 
         /**
@@ -27,27 +23,24 @@ namespace lz {
          * @param end Ending of the iterator.
          * @param start The start of the counting index. 0 is assumed by default.
          */
-        Enumerate(const Iterator begin, const Iterator end, const IntType start = 0) :
-            _begin(start, begin),
-            _end(static_cast<IntType>(std::distance(begin, end)), end) {
+        LZ_CONSTEXPR_CXX_17 Enumerate(const Iterator begin, const Iterator end, const IntType start = 0) :
+            detail::BasicIteratorView<iterator>(iterator(start, begin), iterator(static_cast<IntType>(std::distance(begin, end)), end)) {
         }
 
         Enumerate() = default;
 
-        /**
-         * @brief Returns the beginning of the enumerate iterator object.
-         * @return A random access EnumerateIterator.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
+
 
         /**
-         * @brief Returns the ending of the enumerate object.
-         * @return A random access EnumerateIterator.
+         * @brief Creates a structure of arrays of the sequence: the indexes and the elements are stored in their own
+         * `std::vector`. The vectors are reserved up front with the size of this view.
+         * @return A `std::pair<std::vector<IntType>, std::vector<value_type>>` where `first` contains the indexes and
+         * `second` the elements.
          */
-        iterator end() const override {
-            return _end;
+        std::pair<std::vector<IntType>, std::vector<typename std::iterator_traits<Iterator>::value_type>> toColumns() const {
+            std::pair<std::vector<IntType>, std::vector<typename std::iterator_traits<Iterator>::value_type>> columns;
+            detail::unzipInto(detail::MakeIndexSequence<2>(), this->_begin, this->_end, columns);
+            return columns;
         }
     };
 
@@ -71,7 +64,7 @@ namespace lz {
      * @return Enumerate iterator object from [begin, end).
      */
     template<LZ_CONCEPT_INTEGRAL IntType = int, LZ_CONCEPT_ITERATOR Iterator>
-    Enumerate<Iterator, IntType> enumerateRange(const Iterator begin, const Iterator end, const IntType start = 0) {
+    LZ_CONSTEXPR_CXX_17 Enumerate<Iterator, IntType> enumerateRange(const Iterator begin, const Iterator end, const IntType start = 0) {
 #ifndef LZ_HAS_CONCEPTS
         static_assert(std::is_arithmetic<IntType>::value, "the template parameter IntType is meant for integrals only");
 #endif
@@ -93,7 +86,7 @@ namespace lz {
      * @return Enumerate iterator object. One can iterate over this using `for (auto pair : lz::enumerate(..))`
      */
     template<LZ_CONCEPT_INTEGRAL IntType = int, LZ_CONCEPT_ITERABLE Iterable>
-    Enumerate<detail::IterType<Iterable>, IntType> enumerate(Iterable&& iterable, const  IntType start = 0) {
+    LZ_CONSTEXPR_CXX_17 Enumerate<detail::IterType<Iterable>, IntType> enumerate(Iterable&& iterable, const  IntType start = 0) {
         return enumerateRange(std::begin(iterable), std::end(iterable), start);
     }
 
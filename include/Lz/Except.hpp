@@ -24,10 +24,6 @@ namespace lz {
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * Except constructor. Excepts all elements between [begin, end) contained by [toExceptBegin, toExceptEnd)
@@ -39,33 +35,17 @@ namespace lz {
 #ifdef LZ_HAS_EXECUTION
         Except(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin, const IteratorToExcept toExceptEnd,
             const Execution execPolicy) :
-            _begin(begin, end, toExceptBegin, toExceptEnd, execPolicy),
-            _end(end, end, toExceptBegin, toExceptEnd, execPolicy)
+            detail::BasicIteratorView<iterator>(iterator(begin, end, toExceptBegin, toExceptEnd, execPolicy),
+                                                iterator(end, end, toExceptBegin, toExceptEnd, execPolicy))
         {}
 #else // ^^^ has execution vvv ! has execution
         Except(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin, const IteratorToExcept toExceptEnd) :
-            _begin(begin, end, toExceptBegin, toExceptEnd),
-            _end(end, end, toExceptBegin, toExceptEnd)
+            detail::BasicIteratorView<iterator>(iterator(begin, end, toExceptBegin, toExceptEnd),
+                                                iterator(end, end, toExceptBegin, toExceptEnd))
     	{}
 #endif // end has execution
 
         Except() = default;
-
-        /**
-         * Returns an iterator to the beginning.
-         * @return An iterator to the beginning.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * Returns an iterator to the ending.
-         * @return An iterator to the ending.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
 
     /**
@@ -75,7 +55,8 @@ namespace lz {
 
 #ifdef LZ_HAS_EXECUTION
      /**
-      * @brief This function returns a view to the random access ExceptIterator.
+      * @brief This function returns a view to the ExceptIterator, which is bidirectional if the iterator is bidirectional,
+      * forward otherwise.
       * @details This iterator can be used to 'remove'/'except' elements in range from [`begin`, `end`) contained by
       * [`toExceptBegin`, `toExceptEnd). If elements are changed in `toExcept` after calling begin(), this iterator will not
       * be able to do it correctly.
@@ -100,8 +81,9 @@ namespace lz {
     }
 #else // ^^^ has execution vvv ! has execution
      /**
-      * @brief This function returns a view to the random access ExceptIterator. If elements are changed in `toExcept` after
-      * calling begin(), this iterator will not be able to do it correctly.
+      * @brief This function returns a view to the ExceptIterator, which is bidirectional if the iterator is bidirectional,
+      * forward otherwise. If elements are changed in `toExcept` after calling begin(), this iterator will not be able to do it
+      * correctly.
       * @details This iterator can be used to 'remove'/'except' elements in range from [`begin`, `end`) contained by
       * [`toExceptBegin`, `toExceptEnd).
       * @tparam Iterator Is automatically deduced.
@@ -122,7 +104,8 @@ namespace lz {
 
 #ifdef LZ_HAS_EXECUTION
     /**
-     * @brief This function returns a view to the random access ExceptIterator.
+     * @brief This function returns a view to the ExceptIterator, which is bidirectional if the iterator is bidirectional,
+     * forward otherwise.
      * @details This iterator can be used to 'remove'/'except' elements in range from [`begin`, `end`) contained by
      * [`toExceptBegin`, `toExceptEnd). If elements are changed in `toExcept` after calling begin(), this iterator will not
      * be able to do it correctly.
@@ -145,7 +128,8 @@ namespace lz {
     }
 #else // ^^^ has execution vvv ! has execution
     /**
-     * @brief This function returns a view to the random access ExceptIterator.
+     * @brief This function returns a view to the ExceptIterator, which is bidirectional if the iterator is bidirectional,
+     * forward otherwise.
      * @details This iterator can be used to 'remove'/'except' elements in `iterable` contained by `toExcept`. If `toExcept` is sorted
      * and has an `operator<`. If elements are changed in `toExcept` after calling begin(), this iterator will not be able to do it correctly.
      * @tparam Iterable Is automatically deduced.
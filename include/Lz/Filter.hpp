@@ -3,31 +3,128 @@
 #ifndef LZ_FILTER_HPP
 #define LZ_FILTER_HPP
 
+#include "FilterMap.hpp"
 #include "detail/BasicIteratorView.hpp"
 #include "detail/FilterIterator.hpp"
+#include "Selection.hpp"
 
 
 namespace lz {
+    namespace detail {
+        template<class Function>
+        struct FilterAdaptor;
+    }
+
 #ifdef LZ_HAS_EXECUTION
-    template<class Execution, class Iterator, class Function>
-    class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Execution, Iterator, Function>> {
+    template<class Execution, class Iterator, class Function, class Sentinel = detail::SentinelType<Iterator>>
+    class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Execution, Iterator, Function, Sentinel>> {
+        template<class Second>
+        using Conjunction = Filter<Execution, Iterator, detail::ConjunctionPredicate<Function, Second>, Sentinel>;
+
+        template<class Second>
+        LZ_CONSTEXPR_CXX_20 Conjunction<Second> conjunction(const Second& second) const {
+            const detail::ConjunctionPredicate<Function, Second> predicate(this->_begin._predicate, second);
+            // The beginning already points to the first element for which the first predicate returns true
+            return Conjunction<Second>(this->_begin._iterator, this->_end._iterator, this->_begin._end, predicate,
+                                       this->_begin._execution);
+        }
+
+        template<class MapFunction>
+        using Fused = FilterMap<Execution, Iterator, Function, MapFunction, Sentinel>;
+
+        template<class MapFunction>
+        LZ_CONSTEXPR_CXX_20 Fused<MapFunction> fuse(const MapFunction& function) const {
+            return Fused<MapFunction>(this->_begin._iterator, this->_end._iterator, this->_begin._end, this->_begin._predicate,
+                                      function, this->_begin._execution);
+        }
+
+        void selectParallel(std::vector<Iterator>& selected) const {
+            const Iterator first = this->_begin._iterator;
+            const Iterator last = this->_end._iterator;
+            if (first == last) {
+                return;
+            }
+
+            // The predicate already returned true for the first element, so it is only evaluated for the rest
+            std::vector<char> matches(static_cast<std::size_t>(last - first));
+            matches.front() = true;
+            std::transform(this->_begin._execution, std::next(first), last, std::next(matches.begin()), this->_begin._predicate);
+
+            const auto count = std::count(this->_begin._execution, matches.begin(), matches.end(), static_cast<char>(true));
+            selected.reserve(static_cast<std::size_t>(count));
+            for (std::size_t i = 0; i < matches.size(); i++) {
+                if (matches[i]) {
+                    selected.push_back(first + static_cast<typename std::iterator_traits<Iterator>::difference_type>(i));
+                }
+            }
+        }
 #else
-    template<class Iterator, class Function>
-    class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Iterator, Function>> {
+    template<class Iterator, class Function, class Sentinel = detail::SentinelType<Iterator>>
+    class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Iterator, Function, Sentinel>> {
+        template<class Second>
+        using Conjunction = Filter<Iterator, detail::ConjunctionPredicate<Function, Second>, Sentinel>;
+
+        template<class Second>
+        LZ_CONSTEXPR_CXX_20 Conjunction<Second> conjunction(const Second& second) const {
+            const detail::ConjunctionPredicate<Function, Second> predicate(this->_begin._predicate, second);
+            // The beginning already points to the first element for which the first predicate returns true
+            return Conjunction<Second>(this->_begin._iterator, this->_end._iterator, this->_begin._end, predicate);
+        }
+
+        template<class MapFunction>
+        using Fused = FilterMap<Iterator, Function, MapFunction, Sentinel>;
+
+        template<class MapFunction>
+        LZ_CONSTEXPR_CXX_20 Fused<MapFunction> fuse(const MapFunction& function) const {
+            return Fused<MapFunction>(this->_begin._iterator, this->_end._iterator, this->_begin._end, this->_begin._predicate,
+                                      function);
+        }
 #endif
+
+        template<class Executor>
+        void selectParallel(std::vector<Iterator>& selected, const Executor& executor, std::true_type /* random access */) const {
+            using Difference = typename std::iterator_traits<Iterator>::difference_type;
+
+            const Iterator first = this->_begin._iterator;
+            const Iterator last = this->_end._iterator;
+            if (first == last) {
+                return;
+            }
+
+            // The predicate already returned true for the first element, so it is only evaluated for the rest
+            std::vector<char> matches(static_cast<std::size_t>(last - first));
+            matches.front() = true;
+            const Function& predicate = this->_begin._predicate;
+            const auto evaluate = [first, &matches, &predicate](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+                for (std::size_t i = chunkBegin + 1; i <= chunkEnd; i++) {
+                    matches[i] = static_cast<char>(predicate(*(first + static_cast<Difference>(i))));
+                }
+            };
+            detail::ExecutorTraits<Executor>::forEachChunk(executor, matches.size() - 1, evaluate);
+
+            for (std::size_t i = 0; i < matches.size(); i++) {
+                if (matches[i]) {
+                    selected.push_back(first + static_cast<Difference>(i));
+                }
+            }
+        }
+
+        template<class Executor>
+        void selectParallel(std::vector<Iterator>& selected, const Executor&, std::false_type /* random access */) const {
+            for (iterator it = this->_begin; it != this->_end; ++it) {
+                selected.push_back(it._iterator);
+            }
+        }
+
     public:
 #ifdef LZ_HAS_EXECUTION
-        using iterator = detail::FilterIterator<Execution, Iterator, Function>;
+        using iterator = detail::FilterIterator<Execution, Iterator, Function, Sentinel>;
 #else
-        using iterator = detail::FilterIterator<Iterator, Function>;
+        using iterator = detail::FilterIterator<Iterator, Function, Sentinel>;
 #endif
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief The filter constructor.
@@ -37,9 +134,22 @@ namespace lz {
          * @param function A function with parameter the value type of the iterable and must return a bool.
          */
 #ifdef LZ_HAS_EXECUTION
-        Filter(const Iterator begin, const Iterator end, const Function& function, const Execution execution) :
-            _begin(begin, end, function, execution),
-            _end(end, end, function, execution) {
+        LZ_CONSTEXPR_CXX_20 Filter(const Iterator begin, const Iterator end, const Function& function, const Execution execution) :
+            Filter(begin, end, detail::sentinelFor(end), function, execution) {
+        }
+
+        /**
+         * @brief The filter constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param sentinel The sentinel of `end`, or an UnreachableSentinel if the sequence is infinite.
+         * @param execution The execution policy.
+         * @param function A function with parameter the value type of the iterable and must return a bool.
+         */
+        LZ_CONSTEXPR_CXX_20 Filter(const Iterator begin, const Iterator end, const Sentinel sentinel, const Function& function,
+                                   const Execution execution) :
+            detail::BasicIteratorView<iterator>(iterator(begin, sentinel, function, execution), iterator(end, sentinel, function, execution)) {
+            this->_begin.find();
         }
 #else
         /**
@@ -48,28 +158,86 @@ namespace lz {
          * @param end End of the iterator.
          * @param function A function with parameter the value type of the iterable and must return a bool.
          */
-        Filter(const Iterator begin, const Iterator end, const Function& function) :
-            _begin(begin, end, function),
-            _end(end, end, function) {
+        LZ_CONSTEXPR_CXX_20 Filter(const Iterator begin, const Iterator end, const Function& function) :
+            Filter(begin, end, detail::sentinelFor(end), function) {
+        }
+
+        /**
+         * @brief The filter constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param sentinel The sentinel of `end`, or an UnreachableSentinel if the sequence is infinite.
+         * @param function A function with parameter the value type of the iterable and must return a bool.
+         */
+        LZ_CONSTEXPR_CXX_20 Filter(const Iterator begin, const Iterator end, const Sentinel sentinel, const Function& function) :
+            detail::BasicIteratorView<iterator>(iterator(begin, sentinel, function), iterator(end, sentinel, function)) {
+            this->_begin.find();
         }
 #endif
 
         Filter() = default;
 
         /**
-        * @brief Returns the beginning of the filter iterator object.
-        * @return A forward iterator FilterIterator.
-        */
-        iterator begin() const override {
-            return _begin;
+         * @brief Pipes this filter into another filter. Instead of wrapping this view, both predicates are combined
+         * into one predicate, so that the resulting iterator is not larger than this one.
+         * @param filter The filter to pipe.
+         * @param adaptor The adaptor created by `lz::filter(predicate)`.
+         * @return A filter object over the same sequence, that only contains the elements for which both predicates
+         * return true.
+         */
+        template<class Second>
+        friend LZ_CONSTEXPR_CXX_20 Conjunction<Second> operator|(const Filter& filter, const detail::FilterAdaptor<Second>& adaptor) {
+            return filter.conjunction(adaptor.predicate);
+        }
+
+        /**
+         * @brief Pipes this filter into a map. Instead of a map iterator that holds a filter iterator, one filter map
+         * iterator is created, that holds the underlying iterators, the predicate and the function.
+         * @param filter The filter to pipe.
+         * @param adaptor The adaptor created by `lz::map(function)`.
+         * @return A filter map object over the same sequence, that yields the results of `adaptor`'s function for the
+         * elements for which the predicate returns true.
+         */
+        template<class MapFunction>
+        friend LZ_CONSTEXPR_CXX_20 Fused<MapFunction> operator|(const Filter& filter, const detail::MapAdaptor<MapFunction>& adaptor) {
+            return filter.fuse(adaptor.function);
+        }
+
+        /**
+         * @brief Evaluates the predicate once for every element and stores the positions of the elements for which it
+         * returns true. The resulting selection has an O(1) `size()` and `operator[]`, and reads the elements from
+         * the original sequence instead of copying them.
+         * @details If this filter was created with a parallel execution policy and `Iterator` is random access, the
+         * predicate is evaluated for all elements using that policy first, after which the positions are collected.
+         * @return A random access view over the elements for which the predicate returns true.
+         */
+        Selection<Iterator> toSelection() const {
+            std::vector<Iterator> selected;
+#ifdef LZ_HAS_EXECUTION
+            if constexpr (!detail::IsSequencedPolicyV<Execution> && detail::IsRandomAccess<Iterator>::value) {
+                selectParallel(selected);
+                return Selection<Iterator>(std::move(selected));
+            }
+#endif
+            for (iterator it = this->_begin; it != this->_end; ++it) {
+                selected.push_back(it._iterator);
+            }
+            return Selection<Iterator>(std::move(selected));
         }
 
         /**
-        * @brief Returns the ending of the filter iterator object.
-        * @return A forward iterator FilterIterator.
-        */
-        iterator end() const override {
-            return _end;
+         * @brief Same as `toSelection()`, but if `Iterator` is random access, the predicate is evaluated for all
+         * elements on the threads of `executor` first, e.g. `lz::filter(values, isPrime).toSelection(lz::par(pool))`.
+         * The predicate must be safe to call concurrently.
+         * @tparam Executor Is automatically deduced.
+         * @param executor The executor created by `lz::par(pool)`.
+         * @return A random access view over the elements for which the predicate returns true.
+         */
+        template<class Executor>
+        detail::EnableIf<detail::IsExecutor<Executor>::value, Selection<Iterator>> toSelection(const Executor& executor) const {
+            std::vector<Iterator> selected;
+            selectParallel(selected, executor, detail::IsRandomAccess<Iterator>());
+            return Selection<Iterator>(std::move(selected));
         }
     };
 
@@ -80,7 +248,7 @@ namespace lz {
 
 #ifdef LZ_HAS_EXECUTION
     /**
-     * @brief Returns a forward filter iterator. If the `predicate` returns false, it is excluded.
+     * @brief Returns a forward filter iterator, or a bidirectional one if `Iterator` is bidirectional. If the `predicate` returns false, it is excluded.
      * @details I.e. `lz::filter({1, 2, 3, 4, 5}, [](int i){ return i % 2 == 0; });` will eventually remove all
      * elements that are not even.
      * @tparam Execution Is automatically deduced.
@@ -94,7 +262,7 @@ namespace lz {
      * over.
      */
     template<class Execution = std::execution::sequenced_policy, class Function, LZ_CONCEPT_ITERATOR Iterator>
-    Filter<Execution, Iterator, Function>
+    LZ_CONSTEXPR_CXX_20 Filter<Execution, Iterator, Function>
     filterRange(const Iterator begin, const Iterator end, const Function& predicate, const Execution execution = std::execution::seq) {
         static_assert(std::is_same<detail::FunctionReturnType<Function, typename std::iterator_traits<Iterator>::value_type>, bool>::value,
                       "function must return bool");
@@ -103,7 +271,7 @@ namespace lz {
     }
 #else
     /**
-     * @brief Returns a forward filter iterator. If the `predicate` returns false, it is excluded.
+     * @brief Returns a forward filter iterator, or a bidirectional one if `Iterator` is bidirectional. If the `predicate` returns false, it is excluded.
      * @details I.e. `lz::filter({1, 2, 3, 4, 5}, [](int i){ return i % 2 == 0; });` will eventually remove all
      * elements that are not even.
      * @tparam Iterator Is automatically deduced.
@@ -115,7 +283,7 @@ namespace lz {
      * over.
      */
     template<class Function, LZ_CONCEPT_ITERATOR Iterator>
-    Filter<Iterator, Function> filterRange(const Iterator begin, const Iterator end, const Function& predicate) {
+    LZ_CONSTEXPR_CXX_20 Filter<Iterator, Function> filterRange(const Iterator begin, const Iterator end, const Function& predicate) {
         static_assert(std::is_same<detail::FunctionReturnType<Function, typename std::iterator_traits<Iterator>::value_type>, bool>::value,
                       "function must return bool");
         return Filter<Iterator, Function>(begin, end, predicate);
@@ -124,13 +292,19 @@ namespace lz {
 
 #ifdef LZ_HAS_EXECUTION
     template<class Execution = std::execution::sequenced_policy, class Function, LZ_CONCEPT_ITERABLE Iterable>
-    Filter<Execution, detail::IterType<Iterable>, Function>
+    LZ_CONSTEXPR_CXX_20 Filter<Execution, detail::IterType<Iterable>, Function, detail::SentinelOf<Iterable>>
     filter(Iterable&& iterable, const Function& predicate, const Execution execPolicy = std::execution::seq) {
-        return filterRange(std::begin(iterable), std::end(iterable), predicate, execPolicy);
+        using Iterator = detail::IterType<Iterable>;
+        static_assert(std::is_same<detail::FunctionReturnType<Function, typename std::iterator_traits<Iterator>::value_type>, bool>::value,
+                      "function must return bool");
+        detail::verifyIteratorAndPolicies(execPolicy, std::begin(iterable));
+        // Filters over infinite views store no end
+        return Filter<Execution, Iterator, Function, detail::SentinelOf<Iterable>>(std::begin(iterable), std::end(iterable),
+                                                                                  detail::sentinelOf(iterable), predicate, execPolicy);
     }
 #else
     /**
-     * @brief Returns a forward filter iterator. If the `predicate` returns false, the value it is excluded.
+     * @brief Returns a forward filter iterator, or a bidirectional one if `Iterator` is bidirectional. If the `predicate` returns false, the value it is excluded.
      * @details I.e. `lz::filter({1, 2, 3, 4, 5}, [](int i){ return i % 2 == 0; });` will eventually remove all
      * elements that are not even.
      * @tparam Iterable Is automatically deduced.
@@ -141,11 +315,70 @@ namespace lz {
      * over using `for (auto... lz::filter(...))`.
      */
     template<class Function, LZ_CONCEPT_ITERABLE Iterable>
-    Filter<detail::IterType<Iterable>, Function> filter(Iterable&& iterable, const Function& predicate) {
-        return filterRange(std::begin(iterable), std::end(iterable), predicate);
+    LZ_CONSTEXPR_CXX_20 Filter<detail::IterType<Iterable>, Function, detail::SentinelOf<Iterable>>
+    filter(Iterable&& iterable, const Function& predicate) {
+        using Iterator = detail::IterType<Iterable>;
+        static_assert(std::is_same<detail::FunctionReturnType<Function, typename std::iterator_traits<Iterator>::value_type>, bool>::value,
+                      "function must return bool");
+        // Filters over infinite views store no end
+        return Filter<Iterator, Function, detail::SentinelOf<Iterable>>(std::begin(iterable), std::end(iterable),
+                                                                        detail::sentinelOf(iterable), predicate);
     }
 #endif
 
+    namespace detail {
+        template<class>
+        struct IsFilter : std::false_type {};
+
+#ifdef LZ_HAS_EXECUTION
+        template<class Execution, class Iterator, class Function, class Sentinel>
+        struct IsFilter<Filter<Execution, Iterator, Function, Sentinel>> : std::true_type {};
+
+        template<class Execution, class Iterator, class Function, class Sentinel>
+        struct FusesMap<Filter<Execution, Iterator, Function, Sentinel>> : std::true_type {};
+
+        template<class Execution, class Iterator, class Function>
+        struct IsInfinite<Filter<Execution, Iterator, Function, UnreachableSentinel>> : std::true_type {};
+#else
+        template<class Iterator, class Function, class Sentinel>
+        struct IsFilter<Filter<Iterator, Function, Sentinel>> : std::true_type {};
+
+        template<class Iterator, class Function, class Sentinel>
+        struct FusesMap<Filter<Iterator, Function, Sentinel>> : std::true_type {};
+
+        template<class Iterator, class Function>
+        struct IsInfinite<Filter<Iterator, Function, UnreachableSentinel>> : std::true_type {};
+#endif
+
+        template<class Function>
+        struct FilterAdaptor {
+            Function predicate;
+
+            template<class Iterable, EnableIf<!IsFilter<Decay<Iterable>>::value, int> = 0>
+#ifdef LZ_HAS_EXECUTION
+            friend LZ_CONSTEXPR_CXX_20 Filter<std::execution::sequenced_policy, IterType<Iterable>, Function, SentinelOf<Iterable>>
+#else
+            friend LZ_CONSTEXPR_CXX_20 Filter<IterType<Iterable>, Function, SentinelOf<Iterable>>
+#endif
+            operator|(Iterable&& iterable, const FilterAdaptor& adaptor) {
+                return lz::filter(iterable, adaptor.predicate);
+            }
+        };
+    }
+
+    /**
+     * @brief Returns an adaptor that can be used to create a filter object using pipe syntax, e.g.
+     * `container | lz::filter(predicate)`. Piping a filter object into another filter combines both predicates, so
+     * that no nested filter iterator is created.
+     * @tparam Function Is automatically deduced.
+     * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
+     * @return An adaptor that creates a filter object when piped with an iterable.
+     */
+    template<class Function>
+    LZ_CONSTEXPR_CXX_20 detail::FilterAdaptor<Function> filter(const Function& predicate) {
+        return {predicate};
+    }
+
     // End of group
     /**
      * @}
@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef LZ_FILTER_MAP_HPP
+#define LZ_FILTER_MAP_HPP
+
+#include "Map.hpp"
+#include "detail/BasicIteratorView.hpp"
+#include "detail/FilterMapIterator.hpp"
+
+
+namespace lz {
+#ifdef LZ_HAS_EXECUTION
+    template<class Execution, class Iterator, class Predicate, class Function, class Sentinel = detail::SentinelType<Iterator>>
+    class FilterMap final
+        : public detail::BasicIteratorView<detail::FilterMapIterator<Execution, Iterator, Predicate, Function, Sentinel>> {
+    public:
+        using iterator = detail::FilterMapIterator<Execution, Iterator, Predicate, Function, Sentinel>;
+
+    private:
+        template<class Outer>
+        using Composed = FilterMap<Execution, Iterator, Predicate, detail::ComposedFunction<Outer, Function>, Sentinel>;
+
+        template<class Outer>
+        LZ_CONSTEXPR_CXX_20 Composed<Outer> compose(const Outer& outer) const {
+            const detail::ComposedFunction<Outer, Function> composed(outer, this->_begin._function);
+            return Composed<Outer>(this->_begin._iterator, this->_end._iterator, this->_begin._end, this->_begin._predicate,
+                                   composed, this->_begin._execution);
+        }
+#else
+    template<class Iterator, class Predicate, class Function, class Sentinel = detail::SentinelType<Iterator>>
+    class FilterMap final : public detail::BasicIteratorView<detail::FilterMapIterator<Iterator, Predicate, Function, Sentinel>> {
+    public:
+        using iterator = detail::FilterMapIterator<Iterator, Predicate, Function, Sentinel>;
+
+    private:
+        template<class Outer>
+        using Composed = FilterMap<Iterator, Predicate, detail::ComposedFunction<Outer, Function>, Sentinel>;
+
+        template<class Outer>
+        LZ_CONSTEXPR_CXX_20 Composed<Outer> compose(const Outer& outer) const {
+            const detail::ComposedFunction<Outer, Function> composed(outer, this->_begin._function);
+            return Composed<Outer>(this->_begin._iterator, this->_end._iterator, this->_begin._end, this->_begin._predicate,
+                                   composed);
+        }
+#endif
+
+    public:
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_EXECUTION
+        /**
+         * @brief The filter map constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param predicate A function with parameter the value type of the iterable and must return a bool.
+         * @param function A function with parameter the value type of the iterable. It may return anything.
+         * @param execution The execution policy, used to search for the elements for which `predicate` returns true.
+         */
+        LZ_CONSTEXPR_CXX_20 FilterMap(const Iterator begin, const Iterator end, const Predicate& predicate, const Function& function,
+                                      const Execution execution) :
+            FilterMap(begin, end, detail::sentinelFor(end), predicate, function, execution) {
+        }
+
+        /**
+         * @brief The filter map constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param sentinel The sentinel of `end`, or an UnreachableSentinel if the sequence is infinite.
+         * @param predicate A function with parameter the value type of the iterable and must return a bool.
+         * @param function A function with parameter the value type of the iterable. It may return anything.
+         * @param execution The execution policy, used to search for the elements for which `predicate` returns true.
+         */
+        LZ_CONSTEXPR_CXX_20 FilterMap(const Iterator begin, const Iterator end, const Sentinel sentinel, const Predicate& predicate,
+                                      const Function& function, const Execution execution) :
+            detail::BasicIteratorView<iterator>(iterator(begin, sentinel, predicate, function, execution),
+                                                iterator(end, sentinel, predicate, function, execution)) {
+            this->_begin.find();
+        }
+#else
+        /**
+         * @brief The filter map constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param predicate A function with parameter the value type of the iterable and must return a bool.
+         * @param function A function with parameter the value type of the iterable. It may return anything.
+         */
+        LZ_CONSTEXPR_CXX_20 FilterMap(const Iterator begin, const Iterator end, const Predicate& predicate, const Function& function) :
+            FilterMap(begin, end, detail::sentinelFor(end), predicate, function) {
+        }
+
+        /**
+         * @brief The filter map constructor.
+         * @param begin Beginning of the iterator.
+         * @param end End of the iterator.
+         * @param sentinel The sentinel of `end`, or an UnreachableSentinel if the sequence is infinite.
+         * @param predicate A function with parameter the value type of the iterable and must return a bool.
+         * @param function A function with parameter the value type of the iterable. It may return anything.
+         */
+        LZ_CONSTEXPR_CXX_20 FilterMap(const Iterator begin, const Iterator end, const Sentinel sentinel, const Predicate& predicate,
+                                      const Function& function) :
+            detail::BasicIteratorView<iterator>(iterator(begin, sentinel, predicate, function),
+                                                iterator(end, sentinel, predicate, function)) {
+            this->_begin.find();
+        }
+#endif
+
+        FilterMap() = default;
+
+        /**
+         * @brief Pipes this filter map into a map. Both functions are composed into one function, so that the resulting
+         * iterator is not larger than this one.
+         * @param filterMap The filter map to pipe.
+         * @param adaptor The adaptor created by `lz::map(function)`.
+         * @return A filter map object over the same sequence, that applies this function and then `adaptor`'s function.
+         */
+        template<class Outer>
+        friend LZ_CONSTEXPR_CXX_20 Composed<Outer> operator|(const FilterMap& filterMap, const detail::MapAdaptor<Outer>& adaptor) {
+            return filterMap.compose(adaptor.function);
+        }
+    };
+
+    namespace detail {
+#ifdef LZ_HAS_EXECUTION
+        template<class Execution, class Iterator, class Predicate, class Function, class Sentinel>
+        struct FusesMap<FilterMap<Execution, Iterator, Predicate, Function, Sentinel>> : std::true_type {};
+
+        template<class Execution, class Iterator, class Predicate, class Function>
+        struct IsInfinite<FilterMap<Execution, Iterator, Predicate, Function, UnreachableSentinel>> : std::true_type {};
+#else
+        template<class Iterator, class Predicate, class Function, class Sentinel>
+        struct FusesMap<FilterMap<Iterator, Predicate, Function, Sentinel>> : std::true_type {};
+
+        template<class Iterator, class Predicate, class Function>
+        struct IsInfinite<FilterMap<Iterator, Predicate, Function, UnreachableSentinel>> : std::true_type {};
+#endif
+    }
+}
+
+#endif
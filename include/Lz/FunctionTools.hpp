@@ -14,6 +14,10 @@
 #include "Filter.hpp"
 #include "Take.hpp"
 
+#ifdef LZ_HAS_EXECUTION
+#include <thread>
+#endif // end has execution
+
 #ifdef LZ_HAS_CXX17
 #define LZ_INLINE_VAR inline
 #else // ^^^ inline var vvv !inline var
@@ -55,6 +59,12 @@ namespace lz {
             return true;
         }
 
+        template<class Tuple, std::size_t... I>
+        std::tuple<std::vector<Decay<TupleElement<I, Tuple>>>...> makeColumns(IndexSequence<I...>);
+
+        template<class Tuple>
+        using Columns = decltype(makeColumns<Tuple>(MakeIndexSequence<std::tuple_size<Tuple>::value>()));
+
         template<class To>
         struct ConvertFn {
             template<class From>
@@ -62,6 +72,23 @@ namespace lz {
                 return static_cast<To>(f);
             }
         };
+
+        template<class T, class Projection>
+        class ProjectedEquals {
+            const T& _value;
+            LZ_NO_UNIQUE_ADDRESS Projection _projection;
+
+        public:
+            ProjectedEquals(const T& value, const Projection& projection) :  // NOLINT(modernize-pass-by-value)
+                _value(value),
+                _projection(projection) {
+            }
+
+            template<class U>
+            bool operator()(const U& element) const {
+                return _projection(element) == _value;
+            }
+        };
     }} // namespace detail::<anonymous>
 
     /**
@@ -70,16 +97,19 @@ namespace lz {
     constexpr LZ_INLINE_VAR std::size_t npos = std::numeric_limits<size_t>::max();
 
     /**
-     * Gets the mean of a sequence.
+     * Gets the mean of a sequence. The sequence is evaluated once, the elements are counted while they are summed.
      * @tparam Iterator Is automatically deduced.
      * @param begin The beginning of the sequence.
      * @param end The ending of the sequence.
      * @return The mean of the sequence.
      */
     template<LZ_CONCEPT_ITERATOR Iterator>
-    double mean(const Iterator begin, const Iterator end) {
-        const detail::DifferenceType<Iterator> distance = std::distance(begin, end);
-        const detail::ValueTypeIterator<Iterator> sum = std::accumulate(begin, end, detail::ValueTypeIterator<Iterator>(0));
+    double mean(Iterator begin, const Iterator end) {
+        detail::DifferenceType<Iterator> distance = 0;
+        detail::ValueTypeIterator<Iterator> sum(0);
+        for (; begin != end; ++begin, ++distance) {
+            sum += *begin;
+        }
         return static_cast<double>(sum) / distance;
     }
 
@@ -250,6 +280,25 @@ namespace lz {
         return lz::transAccumulate(std::begin(it), std::end(it), std::move(init), selectorFunc);
     }
 
+    /**
+     * Splits a sequence of tuples or pairs into a tuple of vectors, evaluating the sequence only once. The n-th vector contains
+     * the n-th elements of the tuples/pairs. For example:
+     * ```cpp
+     * auto parsed = lz::map(lines, [](const std::string& s) { return std::make_tuple(s.size(), std::stoi(s)); });
+     * std::tuple<std::vector<std::size_t>, std::vector<int>> unzipped = lz::unzip(parsed);
+     * ```
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable A sequence of which its value type is a `std::tuple` or `std::pair`.
+     * @return A `std::tuple<std::vector<...>...>`, containing a vector for every element of the tuple/pair.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class ValueType = detail::ValueTypeIterable<Iterable>>
+    detail::Columns<ValueType> unzip(Iterable&& iterable) {
+        detail::Columns<ValueType> columns;
+        detail::unzipInto(detail::MakeIndexSequence<std::tuple_size<ValueType>::value>(), std::begin(iterable),
+                          std::end(iterable), columns);
+        return columns;
+    }
+
     /**
      * Returns an iterator that accesses two adjacent elements of one container in a std::tuple<To, To> like fashion.
      * @tparam Iterator Is automatically deduced.
@@ -334,6 +383,61 @@ namespace lz {
         return lz::as<T>(std::begin(iterable), std::end(iterable));
     }
 
+    /**
+     * Returns a view that yields the projection of every element of [begin, end). If the projection returns a reference,
+     * e.g. a pointer to a data member like `&Record::name`, the view yields that reference instead of a copy. The view
+     * has the same iterator category as `Iterator`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param projection The member or function to project every element with.
+     * @return A map iterator that yields the projection of every element.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class Projection>
+    Map<Iterator, detail::Projection<Projection>> projectRange(const Iterator begin, const Iterator end, const Projection projection) {
+        return lz::mapRange(begin, end, detail::Projection<Projection>(projection));
+    }
+
+    /**
+     * Returns a view that yields the projection of every element of `iterable`. If the projection returns a reference,
+     * e.g. a pointer to a data member like `lz::project(records, &Record::name)`, the view yields that reference instead
+     * of a copy. The view has the same iterator category as `iterable`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The sequence to project.
+     * @param projection The member or function to project every element with.
+     * @return A map iterator that yields the projection of every element.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Projection, class Iterator = detail::IterType<Iterable>>
+    Map<Iterator, detail::Projection<Projection>> project(Iterable&& iterable, const Projection projection) {
+        return lz::projectRange(std::begin(iterable), std::end(iterable), projection);
+    }
+
+    /**
+     * Returns a view over the keys of a sequence of pairs, such as a `std::map` or `std::unordered_map`. The keys are
+     * yielded by reference.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence of pairs.
+     * @return A map iterator that yields the `first` member of every pair.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Pair = detail::ValueTypeIterable<Iterable>, class Iterator = detail::IterType<Iterable>>
+    Map<Iterator, detail::MemberProjection<decltype(&Pair::first)>> keys(Iterable&& iterable) {
+        return lz::project(iterable, &Pair::first);
+    }
+
+    /**
+     * Returns a view over the values of a sequence of pairs, such as a `std::map` or `std::unordered_map`. The values
+     * are yielded by reference.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence of pairs.
+     * @return A map iterator that yields the `second` member of every pair.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Pair = detail::ValueTypeIterable<Iterable>, class Iterator = detail::IterType<Iterable>>
+    Map<Iterator, detail::MemberProjection<decltype(&Pair::second)>> values(Iterable&& iterable) {
+        return lz::project(iterable, &Pair::second);
+    }
+
     /**
      * Replaces one occurrence of `oldString` in `string` and replaces it with `newString`, and returns whether there was any newString
      * at all.
@@ -343,7 +447,7 @@ namespace lz {
      * @return `true` if replacing has taken place, `false` otherwise.
      */
      // ReSharper disable once CppNonInlineFunctionDefinitionInHeaderFile
-    bool strReplace(std::string& string, const std::string& oldString, const std::string& newString) {
+    inline bool strReplace(std::string& string, const std::string& oldString, const std::string& newString) {
         return detail::stringReplaceImpl(string, oldString, newString, false);
     }
 
@@ -355,13 +459,14 @@ namespace lz {
      * @return `true` if replacing has taken place, `false` otherwise.
      */
      // ReSharper disable once CppNonInlineFunctionDefinitionInHeaderFile
-    bool strReplaceAll(std::string& string, const std::string& oldString, const std::string& newString) {
+    inline bool strReplaceAll(std::string& string, const std::string& oldString, const std::string& newString) {
         return detail::stringReplaceImpl(string, oldString, newString, true);
     }
 
 #ifdef LZ_HAS_EXECUTION
     /**
-     * Creates a map object with filter iterator that, if the filter function returns true, the map function is executed.
+     * Creates a filter map object that, if the filter function returns true, executes the map function. The filter and
+     * the map are run by a single iterator.
      * @tparam Iterator Is automatically deduced.
      * @tparam UnaryMapFunc Is automatically deduced.
      * @tparam UnaryFilterFunc Is automatically deduced.
@@ -372,20 +477,20 @@ namespace lz {
      * passed to the `mapFunc`.
      * @param mapFunc The function that returns the (new) type.
      * @param execPolicy TThe execution policy. Must be one of `std::execution`'s tags. Performs the find using this execution.
-     * @return A map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
+     * @return A filter map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
      */
     template<class Execution = std::execution::sequenced_policy, class UnaryFilterFunc, class UnaryMapFunc, LZ_CONCEPT_ITERATOR Iterator>
-    Map<detail::FilterIterator<Execution, Iterator, UnaryFilterFunc>, UnaryMapFunc>
+    FilterMap<Execution, Iterator, UnaryFilterFunc, UnaryMapFunc>
 	filterMap(const Iterator begin, const Iterator end, const UnaryFilterFunc& filterFunc, const UnaryMapFunc& mapFunc,
             const Execution execPolicy = std::execution::seq) {
         static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::...");
 
-        Filter<Execution, Iterator, UnaryFilterFunc> filterView = filterRange(begin, end, filterFunc, execPolicy);
-        return lz::map(filterView, mapFunc);
+        return FilterMap<Execution, Iterator, UnaryFilterFunc, UnaryMapFunc>(begin, end, filterFunc, mapFunc, execPolicy);
     }
 
     /**
-     * Creates a map object with filter iterator that, if the filter function returns true, the map function is executed.
+     * Creates a filter map object that, if the filter function returns true, executes the map function. The filter and
+     * the map are run by a single iterator.
      * @tparam Execution Is automatically deduced.
      * @tparam Iterable Is automatically deduced.
      * @tparam UnaryMapFunc Is automatically deduced.
@@ -395,13 +500,16 @@ namespace lz {
      * passed to the `mapFunc`.
      * @param mapFunc The function that returns the (new) type.
      * @param execution TThe execution policy. Must be one of `std::execution`'s tags. Performs the find using this execution.
-     * @return A map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
+     * @return A filter map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
      */
     template<class Execution = std::execution::sequenced_policy, class UnaryFilterFunc, class UnaryMapFunc, LZ_CONCEPT_ITERABLE Iterable>
-    Map<detail::FilterIterator<Execution, detail::IterType<Iterable>, UnaryFilterFunc>, UnaryMapFunc>
+    FilterMap<Execution, detail::IterType<Iterable>, UnaryFilterFunc, UnaryMapFunc, detail::SentinelOf<Iterable>>
 	filterMap(Iterable&& iterable, const UnaryFilterFunc& filterFunc, const UnaryMapFunc& mapFunc,
             const Execution execution = std::execution::seq) {
-        return lz::filterMap(std::begin(iterable), std::end(iterable), filterFunc, mapFunc, execution);
+        static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::...");
+
+        return FilterMap<Execution, detail::IterType<Iterable>, UnaryFilterFunc, UnaryMapFunc, detail::SentinelOf<Iterable>>(
+            std::begin(iterable), std::end(iterable), detail::sentinelOf(iterable), filterFunc, mapFunc, execution);
     }
 
     /**
@@ -416,7 +524,7 @@ namespace lz {
      * even.
      * @return The median of the sequence.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Compare>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Compare, detail::EnableIfPolicy<Execution> = 0>
     double median(const Iterator begin, const Iterator end, const Compare compare, const Execution execution = std::execution::seq) {
         static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::...");
 
@@ -447,7 +555,7 @@ namespace lz {
      * even.
      * @return The median of the sequence.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Compare>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Compare, detail::EnableIfPolicy<Execution> = 0>
     double median(Iterable& iterable, const Compare compare, const Execution execution = std::execution::seq) {
         return lz::median(std::begin(iterable), std::end(iterable), compare, execution);
     }
@@ -462,7 +570,7 @@ namespace lz {
      * even.
      * @return The median of the sequence.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, detail::EnableIfPolicy<Execution> = 0>
     double median(const Iterator begin, const Iterator end, const Execution execution = std::execution::seq) {
         return lz::median(begin, end, std::less<detail::ValueTypeIterator<Iterator>>(), execution);
     }
@@ -476,7 +584,7 @@ namespace lz {
      * even.
      * @return The median of the sequence.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, detail::EnableIfPolicy<Execution> = 0>
     double median(Iterable& iterable, const Execution execution = std::execution::seq) {
         return lz::median(std::begin(iterable), std::end(iterable), std::less<detail::ValueTypeIterable<Iterable>>(), execution);
     }
@@ -494,7 +602,7 @@ namespace lz {
      * @return Either `toFind` or `defaultValue`.
      */
     template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class To,
-        class ValueType = detail::ValueTypeIterator<Iterator>>
+        class ValueType = detail::ValueTypeIterator<Iterator>, detail::EnableIfPolicy<Execution> = 0>
         ValueType findOrDefault(const Iterator begin, const Iterator end, ValueType&& toFind, To&& defaultValue,
             const Execution execution = std::execution::seq) {
         static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::...");
@@ -514,7 +622,7 @@ namespace lz {
      * @return Either `toFind` or `defaultValue`.
      */
     template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class To,
-        class ValueType = detail::ValueTypeIterable<Iterable>>
+        class ValueType = detail::ValueTypeIterable<Iterable>, detail::EnableIfPolicy<Execution> = 0>
         ValueType findOrDefault(const Iterable& iterable, ValueType&& toFind, To&& defaultValue,
             const Execution execution = std::execution::seq) {
         return lz::findOrDefault(std::begin(iterable), std::end(iterable), toFind, defaultValue, execution);
@@ -578,7 +686,7 @@ namespace lz {
      * @param execution Uses the execution to perform the find.
      * @return The index of `val` or lz::npos of no such value exists.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class To>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class To, detail::EnableIfPolicy<Execution> = 0>
     std::size_t indexOf(const Iterator begin, const Iterator end, const To& val, const Execution execution = std::execution::seq) {
         static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::...");
 
@@ -596,7 +704,7 @@ namespace lz {
      * @param execution Uses the execution to perform the find.
      * @return The index of `val` or lz::npos of no such value exists.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class To>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class To, detail::EnableIfPolicy<Execution> = 0>
     std::size_t indexOf(const Iterable& iterable, const To& val, const Execution execution = std::execution::seq) {
         return lz::indexOf(std::begin(iterable), std::end(iterable), val, execution);
     }
@@ -632,6 +740,152 @@ namespace lz {
     std::size_t indexOfIf(const Iterable& iterable, const UnaryFunc predicate, const Execution execution = std::execution::seq) {
         return lz::indexOfIf(std::begin(iterable), std::end(iterable), predicate, execution);
     }
+
+    /**
+     * Gets the median of the projections of a sequence, e.g. `lz::median(records, std::less<double>(), &Record::score)`.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Compare Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence
+     * @param end The ending of the sequence
+     * @param compare Compares two projections. The sequence gets ordered by its projections with nth_element.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the nth_element algorithm + the std::max element if the length of the sequence is
+     * even.
+     * @return The median of the projections of the sequence.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Compare, class Projection,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    double median(const Iterator begin, const Iterator end, const Compare compare, const Projection projection,
+                  const Execution execution = std::execution::seq) {
+        const detail::Projection<Projection> project(projection);
+        const detail::ProjectedCompare<Compare, detail::Projection<Projection>> projectedCompare(compare, project);
+
+        const detail::DifferenceType<Iterator> len = std::distance(begin, end);
+        if (len == 0) {
+            throw std::invalid_argument(LZ_FILE_LINE ": the length of the sequence cannot be 0");
+        }
+
+        const detail::DifferenceType<Iterator> mid = len >> 1;
+        const Iterator midIter = std::next(begin, mid);
+        std::nth_element(execution, begin, midIter, end, projectedCompare);
+
+        if (detail::isEven(len)) {
+            const Iterator leftHalf = std::max_element(execution, begin, midIter, projectedCompare);
+            return (static_cast<double>(project(*leftHalf)) + project(*midIter)) / 2.;
+        }
+        return project(*midIter);
+    }
+
+    /**
+     * Gets the median of the projections of a sequence, e.g. `lz::median(records, std::less<double>(), &Record::score)`.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Compare Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The container/sequence by reference.
+     * @param compare Compares two projections. The sequence gets ordered by its projections with nth_element.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the nth_element algorithm + the std::max element if the length of the sequence is
+     * even.
+     * @return The median of the projections of the sequence.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Compare, class Projection,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    double median(Iterable& iterable, const Compare compare, const Projection projection, const Execution execution = std::execution::seq) {
+        return lz::median(std::begin(iterable), std::end(iterable), compare, projection, execution);
+    }
+
+    /**
+     * Searches [begin, end) for the element of which the projection equals `toFind`. If it exists, the element is returned,
+     * otherwise `defaultValue` is returned.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam To Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param toFind The projection to find.
+     * @param defaultValue The value to return if `toFind` is not found.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the find.
+     * @return Either the element of which the projection equals `toFind`, or `defaultValue`.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class T, class To, class Projection,
+        class ValueType = detail::ValueTypeIterator<Iterator>,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    ValueType findOrDefault(const Iterator begin, const Iterator end, const T& toFind, To&& defaultValue, const Projection projection,
+                            const Execution execution = std::execution::seq) {
+        using Equals = detail::ProjectedEquals<T, detail::Projection<Projection>>;
+        const Iterator pos = std::find_if(execution, begin, end, Equals(toFind, detail::Projection<Projection>(projection)));
+        return pos == end ? defaultValue : *pos;
+    }
+
+    /**
+     * Searches `iterable` for the element of which the projection equals `toFind`. If it exists, the element is returned,
+     * otherwise `defaultValue` is returned.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam To Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The iterable to search.
+     * @param toFind The projection to find.
+     * @param defaultValue The value to return if `toFind` is not found.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the find.
+     * @return Either the element of which the projection equals `toFind`, or `defaultValue`.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class T, class To, class Projection,
+        class ValueType = detail::ValueTypeIterable<Iterable>,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    ValueType findOrDefault(const Iterable& iterable, const T& toFind, To&& defaultValue, const Projection projection,
+                            const Execution execution = std::execution::seq) {
+        return lz::findOrDefault(std::begin(iterable), std::end(iterable), toFind, defaultValue, projection, execution);
+    }
+
+    /**
+     * Searches [begin, end) for the element of which the projection equals `val`, and returns its index, or lz::npos if no
+     * such element exists.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param val The projection to search.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the find.
+     * @return The index of the element or lz::npos of no such element exists.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class T, class Projection,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    std::size_t indexOf(const Iterator begin, const Iterator end, const T& val, const Projection projection,
+                        const Execution execution = std::execution::seq) {
+        using Equals = detail::ProjectedEquals<T, detail::Projection<Projection>>;
+        return lz::indexOfIf(begin, end, Equals(val, detail::Projection<Projection>(projection)), execution);
+    }
+
+    /**
+     * Searches `iterable` for the element of which the projection equals `val`, and returns its index, or lz::npos if no
+     * such element exists.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The iterable to search.
+     * @param val The projection to search.
+     * @param projection The member or function to project every element with.
+     * @param execution Uses the execution to perform the find.
+     * @return The index of the element or lz::npos of no such element exists.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class T, class Projection,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    std::size_t indexOf(const Iterable& iterable, const T& val, const Projection projection, const Execution execution = std::execution::seq) {
+        return lz::indexOf(std::begin(iterable), std::end(iterable), val, projection, execution);
+    }
 #else // ^^^ Lz has execution vvv !Lz has execution
 
     /**
@@ -819,7 +1073,8 @@ namespace lz {
     }
 
     /**
-     * Creates a map object with filter iterator that, if the filter function returns true, the map function is executed.
+     * Creates a filter map object that, if the filter function returns true, executes the map function. The filter and
+     * the map are run by a single iterator.
      * @tparam Iterator Is automatically deduced.
      * @tparam UnaryMapFunc Is automatically deduced.
      * @tparam UnaryFilterFunc Is automatically deduced.
@@ -828,17 +1083,17 @@ namespace lz {
      * @param filterFunc The function that filters the elements. If this function returns `true`, its corresponding container value is
      * passed to the `mapFunc`.
      * @param mapFunc The function that returns the (new) type.
-     * @return A map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
+     * @return A filter map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
      */
     template<class UnaryFilterFunc, class UnaryMapFunc, LZ_CONCEPT_ITERATOR Iterator>
-    Map<detail::FilterIterator<Iterator, UnaryFilterFunc>, UnaryMapFunc>
+    FilterMap<Iterator, UnaryFilterFunc, UnaryMapFunc>
 	filterMap(const Iterator begin, const Iterator end, const UnaryFilterFunc& filterFunc, const UnaryMapFunc& mapFunc) {
-        Filter<Iterator, UnaryFilterFunc> filterView = filterRange(begin, end, filterFunc);
-        return lz::map(filterView, mapFunc);
+        return FilterMap<Iterator, UnaryFilterFunc, UnaryMapFunc>(begin, end, filterFunc, mapFunc);
     }
 
     /**
-     * Creates a map object with filter iterator that, if the filter function returns true, the map function is executed.
+     * Creates a filter map object that, if the filter function returns true, executes the map function. The filter and
+     * the map are run by a single iterator.
      * @tparam Iterable Is automatically deduced.
      * @tparam UnaryMapFunc Is automatically deduced.
      * @tparam UnaryFilterFunc Is automatically deduced.
@@ -846,15 +1101,363 @@ namespace lz {
      * @param filterFunc The function that filters the elements. If this function returns `true`, its corresponding container value is
      * passed to the `mapFunc`.
      * @param mapFunc The function that returns the (new) type.
-     * @return A map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
+     * @return A filter map object that can be iterated over. The `value_type` of the this view object is equal to the return value of `mapFunc`.
      */
     template<class UnaryFilterFunc, class UnaryMapFunc, LZ_CONCEPT_ITERABLE Iterable>
-    Map<detail::FilterIterator<detail::IterType<Iterable>, UnaryFilterFunc>, UnaryMapFunc>
+    FilterMap<detail::IterType<Iterable>, UnaryFilterFunc, UnaryMapFunc, detail::SentinelOf<Iterable>>
 	filterMap(Iterable&& iterable, const UnaryFilterFunc& filterFunc, const UnaryMapFunc& mapFunc) {
-        return lz::filterMap(std::begin(iterable), std::end(iterable), filterFunc, mapFunc);
+        return FilterMap<detail::IterType<Iterable>, UnaryFilterFunc, UnaryMapFunc, detail::SentinelOf<Iterable>>(
+            std::begin(iterable), std::end(iterable), detail::sentinelOf(iterable), filterFunc, mapFunc);
+    }
+
+    /**
+     * Gets the median of the projections of a sequence, e.g. `lz::median(records, std::less<double>(), &Record::score)`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Compare Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence
+     * @param end The ending of the sequence
+     * @param compare Compares two projections. The sequence gets ordered by its projections with nth_element.
+     * @param projection The member or function to project every element with.
+     * @return The median of the projections of the sequence.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class Compare, class Projection>
+    double median(const Iterator begin, const Iterator end, const Compare compare, const Projection projection) {
+        const detail::Projection<Projection> project(projection);
+        const detail::ProjectedCompare<Compare, detail::Projection<Projection>> projectedCompare(compare, project);
+
+        const detail::DifferenceType<Iterator> len = std::distance(begin, end);
+        if (len == 0) {
+            throw std::invalid_argument(LZ_FILE_LINE ": the length of the sequence cannot be 0");
+        }
+
+        const detail::DifferenceType<Iterator> mid = len >> 1;
+        const Iterator midIter = std::next(begin, mid);
+        std::nth_element(begin, midIter, end, projectedCompare);
+
+        if (detail::isEven(len)) {
+            const Iterator leftHalf = std::max_element(begin, midIter, projectedCompare);
+            return (static_cast<double>(project(*leftHalf)) + project(*midIter)) / 2.;
+        }
+        return project(*midIter);
+    }
+
+    /**
+     * Gets the median of the projections of a sequence, e.g. `lz::median(records, std::less<double>(), &Record::score)`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Compare Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The container/sequence by reference.
+     * @param compare Compares two projections. The sequence gets ordered by its projections with nth_element.
+     * @param projection The member or function to project every element with.
+     * @return The median of the projections of the sequence.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Compare, class Projection>
+    double median(Iterable& iterable, const Compare compare, const Projection projection) {
+        return lz::median(std::begin(iterable), std::end(iterable), compare, projection);
+    }
+
+    /**
+     * Searches (begin, end] for the element of which the projection equals `toFind`. If it exists, the element is returned,
+     * otherwise `defaultValue` is returned.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam To Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param toFind The projection to find.
+     * @param defaultValue The value to return if `toFind` is not found.
+     * @param projection The member or function to project every element with.
+     * @return Either the element of which the projection equals `toFind`, or `defaultValue`.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T, class To, class Projection, class ValueType = detail::ValueTypeIterator<Iterator>>
+    ValueType findOrDefault(const Iterator begin, const Iterator end, const T& toFind, To&& defaultValue, const Projection projection) {
+        using Equals = detail::ProjectedEquals<T, detail::Projection<Projection>>;
+        const Iterator pos = std::find_if(begin, end, Equals(toFind, detail::Projection<Projection>(projection)));
+        return pos == end ? defaultValue : *pos;
+    }
+
+    /**
+     * Searches `iterable` for the element of which the projection equals `toFind`. If it exists, the element is returned,
+     * otherwise `defaultValue` is returned.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam To Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The iterable to search.
+     * @param toFind The projection to find.
+     * @param defaultValue The value to return if `toFind` is not found.
+     * @param projection The member or function to project every element with.
+     * @return Either the element of which the projection equals `toFind`, or `defaultValue`.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T, class To, class Projection, class ValueType = detail::ValueTypeIterable<Iterable>>
+    ValueType findOrDefault(const Iterable& iterable, const T& toFind, To&& defaultValue, const Projection projection) {
+        return lz::findOrDefault(std::begin(iterable), std::end(iterable), toFind, defaultValue, projection);
+    }
+
+    /**
+     * Searches (begin, end] for the element of which the projection equals `val`, and returns its index, or lz::npos if no
+     * such element exists.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param val The projection to search.
+     * @param projection The member or function to project every element with.
+     * @return The index of the element or lz::npos of no such element exists.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T, class Projection>
+    std::size_t indexOf(const Iterator begin, const Iterator end, const T& val, const Projection projection) {
+        using Equals = detail::ProjectedEquals<T, detail::Projection<Projection>>;
+        return lz::indexOfIf(begin, end, Equals(val, detail::Projection<Projection>(projection)));
+    }
+
+    /**
+     * Searches `iterable` for the element of which the projection equals `val`, and returns its index, or lz::npos if no
+     * such element exists.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The iterable to search.
+     * @param val The projection to search.
+     * @param projection The member or function to project every element with.
+     * @return The index of the element or lz::npos of no such element exists.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T, class Projection>
+    std::size_t indexOf(const Iterable& iterable, const T& val, const Projection projection) {
+        return lz::indexOf(std::begin(iterable), std::end(iterable), val, projection);
     }
 
 #endif // End LZ_HAS_EXECUTION
+
+    namespace detail {
+        // Sequences that cannot be split are read in buffers of this many elements, that are folded in parallel
+        constexpr std::size_t PrefetchSize = 4096;
+
+        // Folds a non-empty part, starting with its first element
+        template<class T, class BinaryOp>
+        class ReducePart {
+            LZ_NO_UNIQUE_ADDRESS BinaryOp _binaryOp;
+
+        public:
+            explicit ReducePart(const BinaryOp& binaryOp) :  // NOLINT(modernize-pass-by-value)
+                _binaryOp(binaryOp) {
+            }
+
+            template<class Iterator>
+            T operator()(Iterator first, const Iterator last) const {
+                T result(*first);
+                for (++first; first != last; ++first) {
+                    result = _binaryOp(std::move(result), *first);
+                }
+                return result;
+            }
+        };
+
+        // Folds a part, starting with a value initialized `Init`
+        template<class Init, class BinaryOp>
+        class AccumulatePart {
+            LZ_NO_UNIQUE_ADDRESS BinaryOp _binaryOp;
+
+        public:
+            explicit AccumulatePart(const BinaryOp& binaryOp) :  // NOLINT(modernize-pass-by-value)
+                _binaryOp(binaryOp) {
+            }
+
+            template<class Iterator>
+            Init operator()(Iterator first, const Iterator last) const {
+                Init result{};
+                for (; first != last; ++first) {
+                    result = _binaryOp(std::move(result), *first);
+                }
+                return result;
+            }
+        };
+
+#ifdef LZ_HAS_EXECUTION
+        inline std::size_t hardwareThreads() {
+            const unsigned int threads = std::thread::hardware_concurrency();
+            return threads == 0 ? 1 : threads;
+        }
+
+        template<class Execution, class Iterator, class T, class FoldPart, class Combine>
+        T foldRangesWithPolicy(Execution execution, const IteratorRanges<Iterator>& ranges, T init, const FoldPart& foldPart,
+                               const Combine& combine) {
+            std::vector<T> results(ranges.size(), init);
+            std::transform(execution, ranges.begin(), ranges.end(), results.begin(), [&foldPart](const std::pair<Iterator, Iterator>& range) {
+                return foldPart(range.first, range.second);
+            });
+            for (T& result : results) {
+                init = combine(std::move(init), std::move(result));
+            }
+            return init;
+        }
+
+        template<class Execution, class Iterator, class T, class FoldPart, class Combine>
+        T foldWithPolicy(Execution execution, const Iterator begin, const Iterator end, T init, const FoldPart& foldPart,
+                         const Combine& combine, std::forward_iterator_tag) {
+            const IteratorRanges<Iterator> ranges = splitRange(begin, end, 4 * hardwareThreads());
+            return foldRangesWithPolicy(execution, ranges, std::move(init), foldPart, combine);
+        }
+
+        template<class Execution, class Iterator, class T, class FoldPart, class Combine>
+        T foldWithPolicy(Execution execution, Iterator begin, const Iterator end, T init, const FoldPart& foldPart,
+                         const Combine& combine, std::input_iterator_tag) {
+            using Buffer = std::vector<ValueTypeIterator<Iterator>>;
+
+            const IteratorRanges<Iterator> ranges = splitRange(begin, end, 4 * hardwareThreads());
+            if (ranges.size() > 1) {
+                return foldRangesWithPolicy(execution, ranges, std::move(init), foldPart, combine);
+            }
+            Buffer buffer;
+            buffer.reserve(PrefetchSize * hardwareThreads());
+            while (begin != end) {
+                buffer.clear();
+                for (; begin != end && buffer.size() < buffer.capacity(); ++begin) {
+                    buffer.push_back(*begin);
+                }
+                init = foldWithPolicy(execution, buffer.cbegin(), buffer.cend(), std::move(init), foldPart, combine,
+                                      std::forward_iterator_tag());
+            }
+            return init;
+        }
+#endif // end has execution
+    }
+
+    /**
+     * Combines `init` with every element of [begin, end) using `binaryOp`, from left to right, like `std::accumulate`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The initial value.
+     * @param binaryOp A function with parameters `(T, reference)`, that returns a `T`.
+     * @return `init` combined with every element.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp>
+    T reduce(Iterator begin, const Iterator end, T init, const BinaryOp binaryOp) {
+        for (; begin != end; ++begin) {
+            init = binaryOp(std::move(init), *begin);
+        }
+        return init;
+    }
+
+    /**
+     * Combines `init` with every element of `iterable` using `binaryOp`, from left to right, like `std::accumulate`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param iterable The sequence to reduce.
+     * @param init The initial value.
+     * @param binaryOp A function with parameters `(T, reference)`, that returns a `T`.
+     * @return `init` combined with every element.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp>
+    T reduce(const Iterable& iterable, T init, const BinaryOp binaryOp) {
+        return lz::reduce(std::begin(iterable), std::end(iterable), std::move(init), binaryOp);
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    /**
+     * Reduces [begin, end) using the execution policy. The sequence is split into parts (see `split` of the views), or
+     * read in buffers if it cannot be split, and the parts are reduced using `execution`. Unlike `std::reduce`,
+     * `binaryOp` only needs to be associative, because the results of the parts are combined in order.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The initial value.
+     * @param binaryOp An associative function with parameters `(T, T)` and `(T, reference)`, that returns a `T`.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return `init` combined with every element.
+     */
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp, detail::EnableIfPolicy<Execution> = 0>
+    T reduce(const Iterator begin, const Iterator end, T init, const BinaryOp binaryOp, const Execution execution) {
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (detail::IsSequencedPolicyV<Execution>) {
+            return lz::reduce(begin, end, std::move(init), binaryOp);
+        }
+        else {
+            return detail::foldWithPolicy(execution, begin, end, std::move(init), detail::ReducePart<T, BinaryOp>(binaryOp),
+                                          binaryOp, Category());
+        }
+    }
+
+    /**
+     * Reduces `iterable` using the execution policy, e.g. `lz::reduce(values, 0LL, std::plus<long long>(), std::execution::par)`.
+     * Unlike `std::reduce`, `binaryOp` only needs to be associative.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param iterable The sequence to reduce.
+     * @param init The initial value.
+     * @param binaryOp An associative function with parameters `(T, T)` and `(T, reference)`, that returns a `T`.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return `init` combined with every element.
+     */
+    template<class Execution, LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp, detail::EnableIfPolicy<Execution> = 0>
+    T reduce(const Iterable& iterable, T init, const BinaryOp binaryOp, const Execution execution) {
+        return lz::reduce(std::begin(iterable), std::end(iterable), std::move(init), binaryOp, execution);
+    }
+
+    /**
+     * Accumulates [begin, end) using the execution policy. Every part of the sequence is accumulated with `binaryOp`,
+     * starting with `Init()`, after which the results of the parts are combined in order with `combine`, starting with
+     * `init`.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @tparam Combine Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The starting value.
+     * @param binaryOp Function with parameters `(Init, reference)` that specifies what to add to the result of a part.
+     * @param combine An associative function with parameters `(Init, Init)`, of which `Init()` is the identity.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return The result of the transAccumulate operation.
+     */
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Init, class BinaryOp, class Combine, detail::EnableIfPolicy<Execution> = 0>
+    Init transAccumulate(const Iterator begin, const Iterator end, Init init, const BinaryOp binaryOp, const Combine combine,
+                         const Execution execution) {
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (detail::IsSequencedPolicyV<Execution>) {
+            static_cast<void>(combine);
+            return lz::reduce(begin, end, std::move(init), binaryOp);
+        }
+        else {
+            return detail::foldWithPolicy(execution, begin, end, std::move(init), detail::AccumulatePart<Init, BinaryOp>(binaryOp),
+                                          combine, Category());
+        }
+    }
+
+    /**
+     * Accumulates `iterable` using the execution policy. Every part of the sequence is accumulated with `binaryOp`,
+     * starting with `Init()`, after which the results of the parts are combined in order with `combine`, starting with
+     * `init`.
+     * @tparam Execution Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @tparam Combine Is automatically deduced.
+     * @param iterable The sequence to accumulate.
+     * @param init The starting value.
+     * @param binaryOp Function with parameters `(Init, reference)` that specifies what to add to the result of a part.
+     * @param combine An associative function with parameters `(Init, Init)`, of which `Init()` is the identity.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return The result of the transAccumulate operation.
+     */
+    template<class Execution, LZ_CONCEPT_ITERABLE Iterable, class Init, class BinaryOp, class Combine, detail::EnableIfPolicy<Execution> = 0>
+    Init transAccumulate(const Iterable& iterable, Init init, const BinaryOp binaryOp, const Combine combine, const Execution execution) {
+        return lz::transAccumulate(std::begin(iterable), std::end(iterable), std::move(init), binaryOp, combine, execution);
+    }
+#endif // end has execution
 } // End namespace lz
 
 #endif // End LZ_FUNCTION_TOOLS_HPP
\ No newline at end of file
@@ -8,17 +8,13 @@
 
 
 namespace lz {
-    template<LZ_CONCEPT_INVOCABLE GeneratorFunc>
+    template<LZ_CONCEPT_INVOCABLE GeneratorFunc, bool Infinite = false>
     class Generate final : public detail::BasicIteratorView<detail::GenerateIterator<GeneratorFunc>> {
     public:
         using iterator = detail::GenerateIterator<GeneratorFunc>;
         using const_iterator = iterator;
         using value_type = typename std::iterator_traits<iterator>::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief Generator constructor.
@@ -26,31 +22,14 @@ namespace lz {
          * function.
          * @param func The function to execute `amount` of times.
          * @param amount The amount of times to execute. If `amount` is equal to `std::numeric_limits<size_t>::max()`
-         * it is interpreted as a `while-true` loop.
+         * it is interpreted as a `while-true` loop, as the end of the sequence is then never reached.
          */
         Generate(const GeneratorFunc& func, const std::size_t amount):
-            _begin(0, func, amount == std::numeric_limits<std::size_t>::max()),
-            _end(amount, func, amount == std::numeric_limits<std::size_t>::max())
+            detail::BasicIteratorView<iterator>(iterator(0, func), iterator(amount, func))
         {
         }
 
         Generate() = default;
-
-        /**
-        * @brief Returns the beginning of the map iterator object.
-        * @return A bidirectional iterator MapIterator.
-        */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-        * @brief Returns the ending of the map iterator object.
-        * @return A bidirectional iterator MapIterator.
-        */
-        iterator end() const override {
-            return _end;
-        }
     };
 
     /**
@@ -74,15 +53,31 @@ namespace lz {
      * @return A generator random access iterator view object.
      */
     template<LZ_CONCEPT_INVOCABLE GeneratorFunc>
-    Generate<GeneratorFunc> generate(const GeneratorFunc& generatorFunc, const std::size_t amount = std::numeric_limits<std::size_t>::max()) {
+    Generate<GeneratorFunc> generate(const GeneratorFunc& generatorFunc, const std::size_t amount) {
         return Generate<GeneratorFunc>(generatorFunc, amount);
     }
 
+    /**
+     * @brief Returns a view to a generate iterator, that executes `generatorFunc` in a `while-true` loop. Adaptors over
+     * this view, such as `lz::filter`, do not store its end.
+     * @tparam GeneratorFunc Is automatically deduced.
+     * @param generatorFunc The function to execute. The return value of the function is the type that is generated.
+     * @return An infinite generator random access iterator view object.
+     */
+    template<LZ_CONCEPT_INVOCABLE GeneratorFunc>
+    Generate<GeneratorFunc, true> generate(const GeneratorFunc& generatorFunc) {
+        return Generate<GeneratorFunc, true>(generatorFunc, std::numeric_limits<std::size_t>::max());
+    }
 
     // End of group
     /**
      * @}
      */
+
+    namespace detail {
+        template<class GeneratorFunc>
+        struct IsInfinite<Generate<GeneratorFunc, true>> : std::true_type {};
+    }
 }
 
 #endif
\ No newline at end of file
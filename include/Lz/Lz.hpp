@@ -4,13 +4,21 @@
 #define LZ_LZ_HPP
 
 #include "Lz/Affirm.hpp"
+#include "Lz/AsyncMap.hpp"
+#include "Lz/Cache.hpp"
+#include "Lz/Channel.hpp"
 #include "Lz/Concatenate.hpp"
 #include "Lz/Enumerate.hpp"
 #include "Lz/Except.hpp"
 #include "Lz/Generate.hpp"
+#include "Lz/MapMaybe.hpp"
+#include "Lz/MoveFrom.hpp"
+#include "Lz/Own.hpp"
+#include "Lz/Parallel.hpp"
 #include "Lz/Random.hpp"
 #include "Lz/Range.hpp"
 #include "Lz/Repeat.hpp"
+#include "Lz/Stage.hpp"
 #include "Lz/TakeEvery.hpp"
 #include "Lz/Unique.hpp"
 
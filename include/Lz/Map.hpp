@@ -8,17 +8,25 @@
 
 
 namespace lz {
+    namespace detail {
+        template<class Function>
+        struct MapAdaptor;
+    }
+
     template<LZ_CONCEPT_ITERATOR Iterator, class Function>
     class Map final : public detail::BasicIteratorView<detail::MapIterator<Iterator, Function>> {
+        template<class Outer>
+        LZ_CONSTEXPR_CXX_17 Map<Iterator, detail::ComposedFunction<Outer, Function>> compose(const Outer& outer) const {
+            using Composed = detail::ComposedFunction<Outer, Function>;
+            const Composed composed(outer, this->_begin._function);
+            return Map<Iterator, Composed>(this->_begin._iterator, this->_end._iterator, composed);
+        }
+
     public:
         using iterator = detail::MapIterator<Iterator, Function>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief The Map constructor.
@@ -26,27 +34,23 @@ namespace lz {
          * @param end End of the iterator.
          * @param function A function with parameter the value type. It may return anything.
          */
-        Map(const Iterator begin, const Iterator end, const Function& function) :
-            _begin(begin, function),
-            _end(end, function) {
+        LZ_CONSTEXPR_CXX_17 Map(const Iterator begin, const Iterator end, const Function& function) :
+            detail::BasicIteratorView<iterator>(iterator(begin, function), iterator(end, function)) {
         }
 
         Map() = default;
 
         /**
-        * @brief Returns the beginning of the map iterator object.
-        * @return A bidirectional iterator MapIterator.
-        */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-        * @brief Returns the ending of the map iterator object.
-        * @return A bidirectional iterator MapIterator.
-        */
-        iterator end() const override {
-            return _end;
+         * @brief Pipes this map into another map. Instead of wrapping this view, both functions are composed into one
+         * function, so that the resulting iterator is not larger than this one.
+         * @param map The map to pipe.
+         * @param adaptor The adaptor created by `lz::map(function)`.
+         * @return A map object over the same sequence, that applies this function and then `adaptor`'s function.
+         */
+        template<class Outer>
+        friend LZ_CONSTEXPR_CXX_17 Map<Iterator, detail::ComposedFunction<Outer, Function>>
+        operator|(const Map& map, const detail::MapAdaptor<Outer>& adaptor) {
+            return map.compose(adaptor.function);
         }
     };
 
@@ -70,7 +74,7 @@ namespace lz {
      * using `for (auto... lz::map(...))`.
      */
     template<class Function, LZ_CONCEPT_ITERATOR Iterator>
-    Map<Iterator, Function> mapRange(const Iterator begin, const Iterator end, const Function& function) {
+    LZ_CONSTEXPR_CXX_17 Map<Iterator, Function> mapRange(const Iterator begin, const Iterator end, const Function& function) {
         return Map<Iterator, Function>(begin, end, function);
     }
 
@@ -86,10 +90,46 @@ namespace lz {
      * `for (auto... lz::map(...))`.
      */
     template<class Function, LZ_CONCEPT_ITERABLE Iterable>
-    Map<detail::IterType<Iterable>, Function> map(Iterable&& iterable, const Function& function) {
+    LZ_CONSTEXPR_CXX_17 Map<detail::IterType<Iterable>, Function> map(Iterable&& iterable, const Function& function) {
         return mapRange(std::begin(iterable), std::end(iterable), function);
     }
 
+    namespace detail {
+        template<class>
+        struct IsMap : std::false_type {};
+
+        template<class Iterator, class Function>
+        struct IsMap<Map<Iterator, Function>> : std::true_type {};
+
+        // Views that fuse a piped map into themselves instead of being wrapped by it. Specialized by FilterMap.hpp and
+        // Filter.hpp
+        template<class Iterable>
+        struct FusesMap : IsMap<Iterable> {};
+
+        template<class Function>
+        struct MapAdaptor {
+            Function function;
+
+            template<class Iterable, EnableIf<!FusesMap<Decay<Iterable>>::value, int> = 0>
+            friend LZ_CONSTEXPR_CXX_17 Map<IterType<Iterable>, Function> operator|(Iterable&& iterable, const MapAdaptor& adaptor) {
+                return lz::map(iterable, adaptor.function);
+            }
+        };
+    }
+
+    /**
+     * @brief Returns an adaptor that can be used to create a map object using pipe syntax, e.g.
+     * `container | lz::map(function)`. Piping a map object into another map composes both functions, and piping a
+     * filter object into a map creates one filter map iterator, so that no nested iterator is created.
+     * @tparam Function Is automatically deduced.
+     * @param function A function that takes a value type as parameter. It may return anything.
+     * @return An adaptor that creates a map object when piped with an iterable.
+     */
+    template<class Function>
+    LZ_CONSTEXPR_CXX_17 detail::MapAdaptor<Function> map(const Function& function) {
+        return {function};
+    }
+
     // End of group
     /**
      * @}
@@ -0,0 +1,80 @@
+#pragma once
+
+#ifndef LZ_MAP_MAYBE_HPP
+#define LZ_MAP_MAYBE_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/MapMaybeIterator.hpp"
+
+
+namespace lz {
+    template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+    class MapMaybe final : public detail::BasicIteratorView<detail::MapMaybeIterator<Iterator, Function>> {
+    public:
+        using iterator = detail::MapMaybeIterator<Iterator, Function>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+        /**
+         * @brief Creates a view that yields the engaged results of `function`.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param function A function that takes a value type as parameter, and returns e.g. a `std::optional` or a pointer.
+         */
+        MapMaybe(const Iterator begin, const Iterator end, const Function& function) :
+            detail::BasicIteratorView<iterator>(iterator(begin, end, function), iterator(end, end, function)) {
+        }
+
+        MapMaybe() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Maps and filters in one pass: `function` is called once per element, and only the results that are engaged
+     * are yielded, dereferenced. Unlike `lz::filterMap`, work that is needed both to decide whether to keep an element
+     * and to convert it, such as parsing, is done once.
+     * @details E.g. `lz::mapMaybeRange(begin, end, [](const std::string& s) { return tryParse(s); })` yields the parsed
+     * values of the strings that could be parsed, if `tryParse` returns a `std::optional<int>`. The function may return
+     * anything that converts to `bool` and can be dereferenced, such as a pointer.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Function Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param function A function that takes a value type as parameter, and returns e.g. a `std::optional` or a pointer.
+     * @return A forward view over the engaged results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+    MapMaybe<Iterator, Function> mapMaybeRange(const Iterator begin, const Iterator end, const Function& function) {
+        return MapMaybe<Iterator, Function>(begin, end, function);
+    }
+
+    /**
+     * @brief Maps and filters in one pass: `function` is called once per element, and only the results that are engaged
+     * are yielded, dereferenced. Unlike `lz::filterMap`, work that is needed both to decide whether to keep an element
+     * and to convert it, such as parsing, is done once.
+     * @details E.g. `lz::mapMaybe(tokens, [](const std::string& s) { return tryParse(s); })` yields the parsed values of
+     * the tokens that could be parsed, if `tryParse` returns a `std::optional<int>`. The function may return anything
+     * that converts to `bool` and can be dereferenced, such as a pointer.
+     * @tparam Function Is automatically deduced.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to map and filter.
+     * @param function A function that takes a value type as parameter, and returns e.g. a `std::optional` or a pointer.
+     * @return A forward view over the engaged results of `function`.
+     */
+    template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+    MapMaybe<detail::IterType<Iterable>, Function> mapMaybe(Iterable&& iterable, const Function& function) {
+        return mapMaybeRange(std::begin(iterable), std::end(iterable), function);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
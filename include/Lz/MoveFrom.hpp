@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef LZ_MOVE_FROM_HPP
+#define LZ_MOVE_FROM_HPP
+
+#include <iterator>
+
+#include "detail/BasicIteratorView.hpp"
+
+
+namespace lz {
+    namespace detail {
+        // Iterators that yield values by value are moved from already, so they are not wrapped
+        template<class Iterator>
+        using MoveIterator = Conditional<std::is_lvalue_reference<typename std::iterator_traits<Iterator>::reference>::value,
+                                         std::move_iterator<Iterator>, Iterator>;
+    }
+
+    template<class Iterator>
+    class MoveFrom final : public detail::BasicIteratorView<detail::MoveIterator<Iterator>> {
+    public:
+        using iterator = detail::MoveIterator<Iterator>;
+        using const_iterator = iterator;
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+        /**
+         * @brief Creates a view that moves the elements from [begin, end).
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         */
+        MoveFrom(const Iterator begin, const Iterator end) :
+            detail::BasicIteratorView<iterator>(iterator(begin), iterator(end)) {
+        }
+
+        MoveFrom() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a view that moves the elements out of [begin, end) when it is iterated or converted to a
+     * container, instead of copying them.
+     * @tparam Iterator Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @return A view over [begin, end) that yields its elements as rvalues.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    MoveFrom<Iterator> moveFromRange(const Iterator begin, const Iterator end) {
+        return MoveFrom<Iterator>(begin, end);
+    }
+
+    /**
+     * @brief Returns a view that moves the elements out of `iterable` when it is iterated or converted to a container,
+     * instead of copying them. E.g. `lz::moveFrom(lz::take(strings, 10)).toVector()` moves the first ten strings into
+     * the new vector, leaving them in a valid but unspecified state.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to move the elements from.
+     * @return A view over `iterable` that yields its elements as rvalues.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable>
+    MoveFrom<detail::IterType<Iterable>> moveFrom(Iterable&& iterable) {
+        return moveFromRange(std::begin(iterable), std::end(iterable));
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
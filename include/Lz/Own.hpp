@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef LZ_OWN_HPP
+#define LZ_OWN_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/OwnIterator.hpp"
+
+
+namespace lz {
+    template<class Container>
+    class Own final : public detail::BasicIteratorView<detail::OwnIterator<Container>> {
+    public:
+        using iterator = detail::OwnIterator<Container>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        explicit Own(const std::shared_ptr<Container>& container) :
+            detail::BasicIteratorView<iterator>(iterator(std::begin(*container), container),
+                                                iterator(std::end(*container), container)) {
+        }
+
+    public:
+        /**
+         * @brief Creates a view that owns `container`.
+         * @param container The container to move into this view.
+         */
+        explicit Own(Container&& container) :
+            Own(std::make_shared<Container>(std::move(container))) {
+        }
+
+        Own() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Moves a temporary container into a view that keeps it alive, so that views that are created from it can
+     * be returned from a function safely. The container is shared by the iterators and not copied, e.g.
+     * `lz::map(lz::own(readLines()), parse)` owns the lines that are read.
+     * @tparam Container Is automatically deduced. Must be an rvalue.
+     * @param container The container to move into the view.
+     * @return A view over the container, with the same iterator category as the container.
+     */
+    template<class Container>
+    Own<Container> own(Container&& container) {
+        static_assert(!std::is_lvalue_reference<Container>::value,
+                      "lz::own takes ownership of its argument, use std::move or pass a temporary");
+        return Own<Container>(std::move(container));
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
@@ -0,0 +1,344 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_HPP
+#define LZ_PARALLEL_HPP
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "FunctionTools.hpp"
+#include "ThreadPool.hpp"
+
+
+namespace lz {
+    namespace detail {
+        template<class Iterator, class UnaryFunc>
+        std::size_t indexOfIfParallel(const Iterator begin, const Iterator end, const UnaryFunc& predicate, const Par& executor,
+                                      std::true_type /* random access */) {
+            using Difference = typename std::iterator_traits<Iterator>::difference_type;
+
+            // Chunks stop searching as soon as an earlier chunk has found a match
+            std::atomic<std::size_t> first(npos);
+            forEachChunk(executor, static_cast<std::size_t>(end - begin), [begin, &predicate, &first](const std::size_t chunkBegin,
+                                                                                                   const std::size_t chunkEnd) {
+                for (std::size_t i = chunkBegin; i < chunkEnd && i < first.load(std::memory_order_relaxed); i++) {
+                    if (!predicate(*(begin + static_cast<Difference>(i)))) {
+                        continue;
+                    }
+                    std::size_t current = first.load();
+                    while (i < current && !first.compare_exchange_weak(current, i)) {
+                    }
+                    return;
+                }
+            });
+            return first.load();
+        }
+
+        template<class Iterator, class UnaryFunc>
+        std::size_t indexOfIfParallel(const Iterator begin, const Iterator end, const UnaryFunc& predicate, const Par&,
+                                      std::false_type /* random access */) {
+            const Iterator pos = std::find_if(begin, end, predicate);
+            return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
+        }
+
+        // A few parts per thread, so that threads that are done early can steal the remaining parts
+        template<class Iterator>
+        IteratorRanges<Iterator> splitForPool(const Iterator begin, const Iterator end, const Par& executor) {
+            return splitRange(begin, end, 4 * executor.pool().size());
+        }
+
+
+        // The results are combined in order, so the combine function only needs to be associative
+        template<class T, class Futures, class Combine>
+        T combineResults(ThreadPool& pool, Futures& results, T init, const Combine& combine) {
+            // The tasks may refer to the sequence, so all of them must be done before an exception is rethrown
+            for (const std::future<T>& result : results) {
+                pool.wait(result);
+            }
+            for (std::future<T>& result : results) {
+                init = combine(std::move(init), result.get());
+            }
+            return init;
+        }
+
+        template<class Iterator, class T, class FoldPart, class Combine>
+        T foldRanges(const IteratorRanges<Iterator>& ranges, T init, const FoldPart& foldPart, const Combine& combine,
+                     const Par& executor) {
+            ThreadPool& pool = executor.pool();
+            std::vector<std::future<T>> results;
+            for (const std::pair<Iterator, Iterator>& range : ranges) {
+                results.push_back(pool.submit([range, foldPart] { return foldPart(range.first, range.second); }));
+            }
+            return combineResults(pool, results, std::move(init), combine);
+        }
+
+        template<class Iterator, class T, class FoldPart, class Combine>
+        T foldParallel(const Iterator begin, const Iterator end, T init, const FoldPart& foldPart, const Combine& combine,
+                       const Par& executor, std::forward_iterator_tag) {
+            return foldRanges(splitForPool(begin, end, executor), std::move(init), foldPart, combine, executor);
+        }
+
+        // Input iterators that cannot be split, are read on the calling thread while the buffers that were read
+        // already are folded
+        template<class Iterator, class T, class FoldPart, class Combine>
+        T foldParallel(Iterator begin, const Iterator end, T init, const FoldPart& foldPart, const Combine& combine,
+                       const Par& executor, std::input_iterator_tag) {
+            using Buffer = std::vector<ValueTypeIterator<Iterator>>;
+
+            const IteratorRanges<Iterator> ranges = splitForPool(begin, end, executor);
+            if (ranges.size() > 1) {
+                return foldRanges(ranges, std::move(init), foldPart, combine, executor);
+            }
+            ThreadPool& pool = executor.pool();
+            std::deque<std::future<T>> results;
+            while (begin != end) {
+                std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();
+                buffer->reserve(PrefetchSize);
+                for (; begin != end && buffer->size() < PrefetchSize; ++begin) {
+                    buffer->push_back(*begin);
+                }
+                results.push_back(pool.submit([buffer, foldPart] { return foldPart(buffer->cbegin(), buffer->cend()); }));
+
+                // Limits the amount of buffers that are in memory
+                if (results.size() > 2 * pool.size()) {
+                    pool.wait(results.front());
+                    init = combine(std::move(init), results.front().get());
+                    results.pop_front();
+                }
+            }
+            return combineResults(pool, results, std::move(init), combine);
+        }
+    }
+
+    /**
+     * Searches [begin, end) with unary predicate `predicate` on the threads of `executor`, and returns the index of the
+     * first element for which it returns `true`, or lz::npos if no such element exists. The search is only done in
+     * parallel if `Iterator` is random access. The predicate must be safe to call concurrently.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam UnaryFunc Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param predicate The search predicate.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The index of the first element for which `predicate` returns `true`, or lz::npos.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class UnaryFunc>
+    std::size_t indexOfIf(const Iterator begin, const Iterator end, const UnaryFunc predicate, const Par& executor) {
+        return detail::indexOfIfParallel(begin, end, predicate, executor, detail::IsRandomAccess<Iterator>());
+    }
+
+    /**
+     * Searches `iterable` with unary predicate `predicate` on the threads of `executor`, and returns the index of the
+     * first element for which it returns `true`, or lz::npos if no such element exists.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam UnaryFunc Is automatically deduced.
+     * @param iterable The sequence to search.
+     * @param predicate The search predicate.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The index of the first element for which `predicate` returns `true`, or lz::npos.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class UnaryFunc>
+    std::size_t indexOfIf(const Iterable& iterable, const UnaryFunc predicate, const Par& executor) {
+        return lz::indexOfIf(std::begin(iterable), std::end(iterable), predicate, executor);
+    }
+
+    /**
+     * Searches [begin, end) for `val` on the threads of `executor`, and returns the index of its first occurrence, or
+     * lz::npos if no such value exists, e.g. `lz::indexOf(values, 5, lz::par(pool))`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param val The value to search.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The index of `val` or lz::npos of no such value exists.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T>
+    std::size_t indexOf(const Iterator begin, const Iterator end, const T& val, const Par& executor) {
+        using Equals = detail::ProjectedEquals<T, detail::Identity>;
+        return lz::indexOfIf(begin, end, Equals(val, detail::Identity()), executor);
+    }
+
+    /**
+     * Searches `iterable` for `val` on the threads of `executor`, and returns the index of its first occurrence, or
+     * lz::npos if no such value exists.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @param iterable The iterable to search.
+     * @param val The value to search.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The index of `val` or lz::npos of no such value exists.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T>
+    std::size_t indexOf(const Iterable& iterable, const T& val, const Par& executor) {
+        return lz::indexOf(std::begin(iterable), std::end(iterable), val, executor);
+    }
+
+    /**
+     * Splits [begin, end) into parts (see `split` of the views), and calls `function` for every element on the threads
+     * of `executor`. Every part is iterated by a single thread, so the whole pipeline runs in parallel, e.g.
+     * `lz::parallelForEach(lz::map(lz::zip(lz::range(n), values), f), store, lz::par(pool))`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam UnaryFunc Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param function The function to call for every element. Must be safe to call concurrently.
+     * @param executor The executor created by `lz::par(pool)`.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class UnaryFunc>
+    void parallelForEach(const Iterator begin, const Iterator end, const UnaryFunc function, const Par& executor) {
+        const detail::IteratorRanges<Iterator> ranges = detail::splitForPool(begin, end, executor);
+        detail::forEachChunk(executor, ranges.size(), [&ranges, &function](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+            for (std::size_t i = chunkBegin; i < chunkEnd; i++) {
+                for (Iterator it = ranges[i].first; it != ranges[i].second; ++it) {
+                    function(*it);
+                }
+            }
+        });
+    }
+
+    /**
+     * Splits `iterable` into parts (see `split` of the views), and calls `function` for every element on the threads
+     * of `executor`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam UnaryFunc Is automatically deduced.
+     * @param iterable The sequence to iterate.
+     * @param function The function to call for every element. Must be safe to call concurrently.
+     * @param executor The executor created by `lz::par(pool)`.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class UnaryFunc>
+    void parallelForEach(Iterable&& iterable, const UnaryFunc function, const Par& executor) {
+        lz::parallelForEach(std::begin(iterable), std::end(iterable), function, executor);
+    }
+
+    /**
+     * Splits [begin, end) into parts (see `split` of the views), reduces every part on the threads of `executor`, and
+     * combines the results of the parts in order, starting with `init`. The parts start with their first element, so
+     * `binaryOp` must be associative, but not necessarily commutative. Input sequences, which cannot be split, are read
+     * in buffers on the calling thread, which are reduced on the threads of `executor` in the meantime.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The initial value.
+     * @param binaryOp A function with parameters `(T, T)` and `(T, reference)`, that returns a `T`.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return `init` combined with every element, or `init` if the sequence is empty.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp>
+    T parallelReduce(const Iterator begin, const Iterator end, T init, const BinaryOp binaryOp, const Par& executor) {
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        return detail::foldParallel(begin, end, std::move(init), detail::ReducePart<T, BinaryOp>(binaryOp), binaryOp, executor,
+                                    Category());
+    }
+
+    /**
+     * Splits `iterable` into parts (see `split` of the views), reduces every part on the threads of `executor`, and
+     * combines the results of the parts in order, starting with `init`, e.g.
+     * `lz::parallelReduce(lz::map(values, square), 0.0, std::plus<double>(), lz::par(pool))`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param iterable The sequence to reduce.
+     * @param init The initial value.
+     * @param binaryOp A function with parameters `(T, T)` and `(T, reference)`, that returns a `T`. Must be
+     * associative.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return `init` combined with every element, or `init` if the sequence is empty.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp>
+    T parallelReduce(const Iterable& iterable, T init, const BinaryOp binaryOp, const Par& executor) {
+        return lz::parallelReduce(std::begin(iterable), std::end(iterable), std::move(init), binaryOp, executor);
+    }
+
+
+    /**
+     * Reduces [begin, end) on the threads of `executor`. This is the same as `lz::parallelReduce`: `binaryOp` must be
+     * associative, and accept `(T, T)` as well as `(T, reference)`.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The initial value.
+     * @param binaryOp An associative function with parameters `(T, T)` and `(T, reference)`, that returns a `T`.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return `init` combined with every element.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp>
+    T reduce(const Iterator begin, const Iterator end, T init, const BinaryOp binaryOp, const Par& executor) {
+        return lz::parallelReduce(begin, end, std::move(init), binaryOp, executor);
+    }
+
+    /**
+     * Reduces `iterable` on the threads of `executor`, e.g. `lz::reduce(values, 0LL, std::plus<long long>(), lz::par(pool))`.
+     * This is the same as `lz::parallelReduce`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam T Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param iterable The sequence to reduce.
+     * @param init The initial value.
+     * @param binaryOp An associative function with parameters `(T, T)` and `(T, reference)`, that returns a `T`.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return `init` combined with every element.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp>
+    T reduce(const Iterable& iterable, T init, const BinaryOp binaryOp, const Par& executor) {
+        return lz::parallelReduce(std::begin(iterable), std::end(iterable), std::move(init), binaryOp, executor);
+    }
+
+    /**
+     * Accumulates [begin, end) on the threads of `executor`. Every part of the sequence is accumulated with `binaryOp`,
+     * starting with `Init()`, after which the results of the parts are combined in order with `combine`, starting with
+     * `init`. For example, to sum all string sizes:
+     * ```cpp
+     * std::size_t totalSize = lz::transAccumulate(s.begin(), s.end(), std::size_t(0), [](std::size_t i, const std::string& rhs) {
+     *      return i + rhs.size();
+     * }, std::plus<std::size_t>(), lz::par(pool));
+     * ```
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @tparam Combine Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param init The starting value.
+     * @param binaryOp Function with parameters `(Init, reference)` that specifies what to add to the result of a part.
+     * @param combine An associative function with parameters `(Init, Init)`, of which `Init()` is the identity.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The result of the transAccumulate operation.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class Init, class BinaryOp, class Combine>
+    Init transAccumulate(const Iterator begin, const Iterator end, Init init, const BinaryOp binaryOp, const Combine combine,
+                         const Par& executor) {
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        return detail::foldParallel(begin, end, std::move(init), detail::AccumulatePart<Init, BinaryOp>(binaryOp), combine,
+                                    executor, Category());
+    }
+
+    /**
+     * Accumulates `iterable` on the threads of `executor`. Every part of the sequence is accumulated with `binaryOp`,
+     * starting with `Init()`, after which the results of the parts are combined in order with `combine`, starting with
+     * `init`.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @tparam Combine Is automatically deduced.
+     * @param iterable The sequence to accumulate.
+     * @param init The starting value.
+     * @param binaryOp Function with parameters `(Init, reference)` that specifies what to add to the result of a part.
+     * @param combine An associative function with parameters `(Init, Init)`, of which `Init()` is the identity.
+     * @param executor The executor created by `lz::par(pool)`.
+     * @return The result of the transAccumulate operation.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Init, class BinaryOp, class Combine>
+    Init transAccumulate(const Iterable& iterable, Init init, const BinaryOp binaryOp, const Combine combine, const Par& executor) {
+        return lz::transAccumulate(std::begin(iterable), std::end(iterable), std::move(init), binaryOp, combine, executor);
+    }
+}
+
+#endif // End LZ_PARALLEL_HPP
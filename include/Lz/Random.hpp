@@ -8,48 +8,26 @@
 
 
 namespace lz {
-    template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution>
+    template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, bool Infinite = false>
     class Random final : public detail::BasicIteratorView<detail::RandomIterator<Arithmetic, Distribution>> {
     public:
         using iterator = detail::RandomIterator<Arithmetic, Distribution>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin;
-        iterator _end;
-
     public:
         /**
          * @brief Random view object constructor, from [`min, max`].
          * @param min The minimum value of the random number (included).
          * @param max The maximum value of the random number (included).
          * @param amount The amount of random numbers to generate. If `std::numeric_limits<size_t>::max()` it is
-         * interpreted as a `while-true` loop.
-         * @param isWhileTrueLoop Boolean to indicate if it's a while true loop.
+         * interpreted as a `while-true` loop, as the end of the sequence is then never reached.
          */
-        Random(const Arithmetic min, const Arithmetic max, const std::size_t amount, const bool isWhileTrueLoop) :
-            _begin(min, max, 0, isWhileTrueLoop),
-            _end(min, max, amount, isWhileTrueLoop) {
+        Random(const Arithmetic min, const Arithmetic max, const std::size_t amount) :
+            detail::BasicIteratorView<iterator>(iterator(min, max, 0), iterator(min, max, amount)) {
         }
 
         Random() = default;
-
-        /**
-         * @brief Returns the beginning of the sequence.
-         * @return The beginning of the sequence.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * @brief Returns the ending of the sequence.
-         * @return The ending of the sequence.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
 	
     /**
@@ -64,14 +42,27 @@ namespace lz {
       * @tparam Integral Is automatically deduced. Must be arithmetic type.
       * @param min The minimum value , included.
       * @param max The maximum value, included.
-      * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
-      * it is interpreted as a `while-true` loop.
+      * @param amount The amount of numbers to create.
       * @return A random view object that generates a sequence of random numbers
       */
     template<class Integral, class Distribution = std::uniform_int_distribution<Integral>>
     static detail::EnableIf<std::is_integral<Integral>::value, Random<Integral, Distribution>>
-    random(const Integral min, const Integral max, const std::size_t amount = std::numeric_limits<std::size_t>::max()) {
-        return Random<Integral, Distribution>(min, max, amount, amount == std::numeric_limits<std::size_t>::max());
+    random(const Integral min, const Integral max, const std::size_t amount) {
+        return Random<Integral, Distribution>(min, max, amount);
+    }
+
+    /**
+     * @brief Returns a random view object that generates random numbers in a `while-true` loop, using a uniform
+     * distribution. Adaptors over this view, such as `lz::filter`, do not store its end.
+     * @tparam Integral Is automatically deduced. Must be arithmetic type.
+     * @param min The minimum value , included.
+     * @param max The maximum value, included.
+     * @return An infinite random view object that generates a sequence of random numbers
+     */
+    template<class Integral, class Distribution = std::uniform_int_distribution<Integral>>
+    static detail::EnableIf<std::is_integral<Integral>::value, Random<Integral, Distribution, true>>
+    random(const Integral min, const Integral max) {
+        return Random<Integral, Distribution, true>(min, max, std::numeric_limits<std::size_t>::max());
     }
 
     /**
@@ -81,14 +72,26 @@ namespace lz {
      * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence (8x) of `std::random_device` as seed.
      * @param min The minimum value, included.
      * @param max The maximum value, included.
-     * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
-     * it is interpreted as a `while-true` loop.
+     * @param amount The amount of numbers to create.
      * @return A random view object that generates a sequence of random doubles.
      */
     template<class Floating, class Distribution = std::uniform_real_distribution<Floating>>
     static detail::EnableIf<std::is_floating_point<Floating>::value, Random<Floating, Distribution>>
-    random(const Floating min, const Floating max, const std::size_t amount = std::numeric_limits<std::size_t>::max()) {
-        return Random<Floating, Distribution>(min, max, amount, amount == std::numeric_limits<std::size_t>::max());
+    random(const Floating min, const Floating max, const std::size_t amount) {
+        return Random<Floating, Distribution>(min, max, amount);
+    }
+
+    /**
+     * @brief Returns a random view object that generates random floating point numbers in a `while-true` loop, using a
+     * uniform distribution. Adaptors over this view, such as `lz::filter`, do not store its end.
+     * @param min The minimum value, included.
+     * @param max The maximum value, included.
+     * @return An infinite random view object that generates a sequence of random doubles.
+     */
+    template<class Floating, class Distribution = std::uniform_real_distribution<Floating>>
+    static detail::EnableIf<std::is_floating_point<Floating>::value, Random<Floating, Distribution, true>>
+    random(const Floating min, const Floating max) {
+        return Random<Floating, Distribution, true>(min, max, std::numeric_limits<std::size_t>::max());
     }
 
 	template<class T, class>
@@ -101,6 +104,11 @@ namespace lz {
     /**
      * @}
      */
+
+    namespace detail {
+        template<class Arithmetic, class Distribution>
+        struct IsInfinite<Random<Arithmetic, Distribution, true>> : std::true_type {};
+    }
 }
 
 #endif
\ No newline at end of file
@@ -16,10 +16,6 @@ namespace lz {
         using reverse_iterator = std::reverse_iterator<iterator>;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
 
         /**
@@ -28,43 +24,28 @@ namespace lz {
          * @param end The end of the counting.
          * @param step The step that gets added every iteration.
          */
-        Range(const Arithmetic start, const Arithmetic end, const Arithmetic step) :
-            _begin(start, step),
-            _end(end, step) {
+        LZ_CONSTEXPR_CXX_17 Range(const Arithmetic start, const Arithmetic end, const Arithmetic step) :
+            detail::BasicIteratorView<iterator>(iterator(start, step), iterator(end, step)) {
         }
 
         Range() = default;
 
-        /**
-         * @brief Returns the beginning of the random access Range iterator
-         * @return The beginning of the random access Range iterator
-         */
-        iterator begin() const override {
-            return _begin;
-        }
 
-        /**
-         * @brief Returns the ending of the random access Range iterator
-         * @return The ending of the random access Range iterator
-         */
-        iterator end() const override {
-            return _end;
-        }
 
         /**
          * @brief Returns the reverse beginning of the random access Range iterator
          * @return The reverse beginning of the random access Range iterator
          */
-        reverse_iterator rbegin() const {
-            return reverse_iterator(begin());
+        LZ_CONSTEXPR_CXX_17 reverse_iterator rbegin() const {
+            return reverse_iterator(this->begin());
         }
 
         /**
          * @brief Returns the reverse ending of the random access Range iterator
          * @return The reverse ending of the random access Range iterator
          */
-        reverse_iterator rend() const {
-            return reverse_iterator(end());
+        LZ_CONSTEXPR_CXX_17 reverse_iterator rend() const {
+            return reverse_iterator(this->end());
         }
     };
 
@@ -86,7 +67,7 @@ namespace lz {
      * `for (auto... lz::range(...))`.
      */
     template<LZ_CONCEPT_ARITHMETIC Arithmetic = int>
-    Range<Arithmetic> range(const Arithmetic start, const Arithmetic end, const Arithmetic step = 1) {
+    LZ_CONSTEXPR_CXX_17 Range<Arithmetic> range(const Arithmetic start, const Arithmetic end, const Arithmetic step = 1) {
         static_assert(std::is_arithmetic<Arithmetic>::value, "type must be of type arithmetic");
         if (step == 0) {
             throw std::range_error(LZ_FILE_LINE ": with a step size of 0, the sequence can never end");
@@ -110,7 +91,7 @@ namespace lz {
      * `for (auto... lz::range(...))`.
      */
     template<LZ_CONCEPT_ARITHMETIC Arithmetic = int>
-    Range<Arithmetic> range(const Arithmetic end) {
+    LZ_CONSTEXPR_CXX_17 Range<Arithmetic> range(const Arithmetic end) {
         return range<Arithmetic>(0, end, 1);
     }
 
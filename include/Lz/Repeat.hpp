@@ -8,7 +8,7 @@
 
 
 namespace lz {
-    template<class T>
+    template<class T, bool Infinite = false>
     class Repeat final : public detail::BasicIteratorView<detail::RepeatIterator<T>> {
     public:
         using iterator = detail::RepeatIterator<T>;
@@ -16,8 +16,7 @@ namespace lz {
 
     private:
         detail::RepeatIteratorHelper<T> _iteratorHelper{};
-        iterator _begin{};
-        iterator _end{};
+        std::size_t _amount{};
 
     public:
         /**
@@ -26,29 +25,30 @@ namespace lz {
          * @param amount The amount of times to repeat the loop, returning `toRepeat`.
          */
         Repeat(T toRepeat, const std::size_t amount):
-            _iteratorHelper(std::move(toRepeat), amount == std::numeric_limits<std::size_t>::max()),
-            _begin(&_iteratorHelper, 0),
-            _end(&_iteratorHelper, amount)
+            detail::BasicIteratorView<iterator>(iterator(&_iteratorHelper, 0), iterator(&_iteratorHelper, amount)),
+            _iteratorHelper(std::move(toRepeat)),
+            _amount(amount)
             {
         }
 
-        Repeat() = default;
-
         /**
-         * @brief Returns the beginning of the sequence.
-         * @return The beginning of the sequence.
+         * @brief Copies the repeat object. The iterators point to the value that is owned by this object, so they are
+         * reconstructed instead of being copied.
+         * @param other The repeat object to copy.
          */
-        iterator begin() const override {
-            return _begin;
+        Repeat(const Repeat& other) :
+            Repeat(other._iteratorHelper.toRepeat, other._amount) {
         }
 
-        /**
-         * @brief Returns the ending of the sequence.
-         * @return The ending of the sequence.
-         */
-        iterator end() const override {
-            return _end;
+        Repeat& operator=(const Repeat& other) {
+            _iteratorHelper = other._iteratorHelper;
+            _amount = other._amount;
+            this->_begin = iterator(&_iteratorHelper, 0);
+            this->_end = iterator(&_iteratorHelper, _amount);
+            return *this;
         }
+
+        Repeat() = default;
     };
 
     // Start of group
@@ -58,22 +58,38 @@ namespace lz {
      */
 
     /**
-     * @brief Returns `toRepeat`, `amount` of times. If amount is left empty, it never stops and is interpreted as a
-     * `while-true` loop.
+     * @brief Returns `toRepeat`, `amount` of times.
      * @tparam T Is automatically deduced by the compiler.
      * @param toRepeat The value to repeat `amount` times.
      * @param amount The amount of times to repeat the loop, returning `toRepeat`.
      * @return A repeat object, containing the random access iterator.
      */
     template<class T>
-    Repeat<T> repeat(T toRepeat, const std::size_t amount = std::numeric_limits<std::size_t>::max()) {
+    Repeat<T> repeat(T toRepeat, const std::size_t amount) {
         return Repeat<T>(std::move(toRepeat), amount);
     }
 
+    /**
+     * @brief Returns `toRepeat` in a `while-true` loop. Adaptors over this view, such as `lz::filter`, do not store its
+     * end.
+     * @tparam T Is automatically deduced by the compiler.
+     * @param toRepeat The value to repeat.
+     * @return An infinite repeat object, containing the random access iterator.
+     */
+    template<class T>
+    Repeat<T, true> repeat(T toRepeat) {
+        return Repeat<T, true>(std::move(toRepeat), std::numeric_limits<std::size_t>::max());
+    }
+
     //End of group
     /**
      * @}
      */
+
+    namespace detail {
+        template<class T>
+        struct IsInfinite<Repeat<T, true>> : std::true_type {};
+    }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#ifndef LZ_SELECTION_HPP
+#define LZ_SELECTION_HPP
+
+#include <vector>
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/SelectionIterator.hpp"
+
+
+namespace lz {
+    template<class Iterator>
+    class Selection final : public detail::BasicIteratorView<detail::SelectionIterator<Iterator>> {
+    public:
+        using iterator = detail::SelectionIterator<Iterator>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+        using reference = typename iterator::reference;
+
+    private:
+        std::vector<Iterator> _selected{};
+
+        void setIterators() {
+            this->_begin = iterator(_selected.data());
+            this->_end = iterator(_selected.data() + _selected.size());
+        }
+
+    public:
+        /**
+         * @brief Creates a selection over the elements that `selected` points to.
+         * @param selected The positions of the selected elements in the original sequence.
+         */
+        explicit Selection(std::vector<Iterator> selected) :
+            _selected(std::move(selected)) {
+            setIterators();
+        }
+
+        /**
+         * @brief Copies the selection object. The iterators point to the positions that are owned by this object, so
+         * they are reconstructed instead of being copied.
+         * @param other The selection object to copy.
+         */
+        Selection(const Selection& other) :
+            Selection(other._selected) {
+        }
+
+        Selection& operator=(const Selection& other) {
+            _selected = other._selected;
+            setIterators();
+            return *this;
+        }
+
+        // Moving a vector keeps its buffer, so the iterators stay valid
+        Selection(Selection&&) = default;
+
+        Selection& operator=(Selection&&) = default;
+
+        Selection() = default;
+
+        /**
+         * @brief Returns the amount of selected elements in O(1).
+         * @return The amount of selected elements.
+         */
+        std::size_t size() const {
+            return _selected.size();
+        }
+
+        /**
+         * @brief Returns the selected element at `index` in O(1). The element is read from the original sequence.
+         * @param index The index of the selected element. Must be smaller than `size()`.
+         * @return A reference to the element in the original sequence.
+         */
+        reference operator[](const std::size_t index) const {
+            return *_selected[index];
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef LZ_STAGE_HPP
+#define LZ_STAGE_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/StageIterator.hpp"
+
+
+namespace lz {
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    class Stage final : public detail::BasicIteratorView<detail::StageIterator<Iterator>> {
+    public:
+        using iterator = detail::StageIterator<Iterator>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        using State = detail::StageState<Iterator>;
+
+    public:
+        /**
+         * @brief Creates a view that reads [begin, end) on a thread of its own.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param capacity The maximum amount of elements that are read ahead.
+         */
+        Stage(const Iterator begin, const Iterator end, const std::size_t capacity) :
+            detail::BasicIteratorView<iterator>(iterator(std::make_shared<State>(begin, end, capacity)), iterator()) {
+        }
+
+        Stage() = default;
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a view that iterates [begin, end) on a dedicated thread, and passes the elements to the thread
+     * that reads the view through a lock-free single producer, single consumer queue of `capacity` elements. Everything
+     * upstream of the stage then runs concurrently with everything downstream of it, while the order of the elements
+     * is kept, e.g. `lz::map(lz::stage(lz::map(lines, parse), 256), enrich)` parses and enriches on two cores.
+     * @details The thread is started when the view is read for the first time, and stops when the sequence is done or
+     * the view is destroyed. [begin, end) is only iterated by that thread, so it must not be iterated by other threads
+     * in the meantime, and it must outlive the view. The view can be iterated once. If the sequence throws, the
+     * exception is rethrown when the element that could not be read is reached.
+     * @tparam Iterator Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param capacity The maximum amount of elements that are read ahead.
+     * @return An input view over the elements of [begin, end).
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    Stage<Iterator> stageRange(const Iterator begin, const Iterator end, const std::size_t capacity = 1024) {
+        return Stage<Iterator>(begin, end, capacity);
+    }
+
+    /**
+     * @brief Returns a view that iterates `iterable` on a dedicated thread, and passes the elements to the thread that
+     * reads the view through a lock-free single producer, single consumer queue of `capacity` elements. Everything
+     * upstream of the stage then runs concurrently with everything downstream of it, while the order of the elements
+     * is kept, e.g. `lz::map(lz::stage(lz::map(lines, parse), 256), enrich)` parses and enriches on two cores.
+     * @details The thread is started when the view is read for the first time, and stops when the sequence is done or
+     * the view is destroyed. `iterable` is only iterated by that thread, so it must not be iterated by other threads
+     * in the meantime, and it must outlive the view. The view can be iterated once. If the sequence throws, the
+     * exception is rethrown when the element that could not be read is reached.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The sequence to read on a dedicated thread.
+     * @param capacity The maximum amount of elements that are read ahead.
+     * @return An input view over the elements of `iterable`.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable>
+    Stage<detail::IterType<Iterable>> stage(Iterable&& iterable, const std::size_t capacity = 1024) {
+        return stageRange(std::begin(iterable), std::end(iterable), capacity);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
+
+#endif
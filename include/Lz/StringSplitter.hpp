@@ -17,35 +17,60 @@ namespace lz {
     private:
         detail::SplitViewIteratorHelper<String> _splitIteratorHelper{};
 
+        // The iterators read from the helper when constructed, so they can only be created after it is initialized
+        void setIterators() {
+            this->_begin = const_iterator(0, &_splitIteratorHelper);
+            this->_end = const_iterator(_splitIteratorHelper.string.size(), &_splitIteratorHelper);
+        }
+
     public:
         using value_type = SubString;
 
         /**
-         * @brief Creates a String splitter object. Its `begin()` and `end()` return an input iterator.
+         * @brief Creates a String splitter object. Its `begin()` and `end()` return an input iterator. If `str` is an
+         * rvalue, it is moved into this object.
          * @param str The string to split.
          * @param delimiter The delimiter to split on.
          */
         StringSplitter(String&& str, std::string&& delimiter) :
             _splitIteratorHelper(std::move(delimiter), std::forward<String>(str)) {
+            setIterators();
         }
 
-        StringSplitter() = default;
-
         /**
-         * @brief Returns an input string split iterator to the beginning.
-         * @return A input string split iterator to the beginning.
+         * @brief Copies the string splitter. The iterators point to the helper that is owned by this object, so they
+         * are reconstructed instead of being copied.
+         * @param other The string splitter to copy.
          */
-        const_iterator begin() const override {
-            return const_iterator(0, &_splitIteratorHelper);
+        StringSplitter(const StringSplitter& other) :
+            detail::BasicIteratorView<const_iterator>(),
+            _splitIteratorHelper(other._splitIteratorHelper) {
+            setIterators();
         }
 
         /**
-         * @brief Returns an input string split iterator to the ending.
-         * @return A input string split iterator to the ending.
+         * @brief Moves the string splitter. If the string is owned by `other`, it is moved instead of copied.
+         * @param other The string splitter to move.
          */
-        const_iterator end() const override {
-            return const_iterator(_splitIteratorHelper.string.size(), &_splitIteratorHelper);
+        StringSplitter(StringSplitter&& other) noexcept :
+            detail::BasicIteratorView<const_iterator>(),
+            _splitIteratorHelper(std::move(other._splitIteratorHelper)) {
+            setIterators();
+        }
+
+        StringSplitter& operator=(const StringSplitter& other) {
+            _splitIteratorHelper = other._splitIteratorHelper;
+            setIterators();
+            return *this;
+        }
+
+        StringSplitter& operator=(StringSplitter&& other) noexcept {
+            _splitIteratorHelper = std::move(other._splitIteratorHelper);
+            setIterators();
+            return *this;
         }
+
+        StringSplitter() = default;
     };
 
 #ifdef LZ_HAS_STRING_VIEW
@@ -65,6 +90,8 @@ namespace lz {
      * @brief This is a lazy evaluated string splitter function. If not using C++17 or higher, you can use `std::move`
      * to safely move the substring, that is returned by the
      * `StringSplitter<SubString>::const_iterator::operator*`. Its `begin()` and `end()` return an input iterator.
+     * If `str` is an rvalue, e.g. a temporary `std::string`, it is moved into the splitter, so that it can be returned
+     * from a function safely. Otherwise the splitter refers to `str`.
      * @tparam SubString The type that gets returned when the `StringSplitter<SubString>::const_iterator::operator*` is
      * called. Can be specified, but if C++17 or higher is defined, `std::string_view` is used, otherwise `std::string`.
      * @param str The string to split.
@@ -15,10 +15,6 @@ namespace lz {
 
         using value_type = typename std::iterator_traits<Iterator>::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief Takes elements from an iterator from [begin, ...) while the function returns true. If the function
@@ -30,10 +26,9 @@ namespace lz {
          */
         template<class Function>
         Take(const Iterator begin, const Iterator end, const Function predicate) :
-            _begin(begin),
-            _end(end) {
-            if (_begin != _end) {
-                _begin = !predicate(*_begin) ? end : _begin;
+            detail::BasicIteratorView<iterator>(begin, end) {
+            if (this->_begin != this->_end) {
+                this->_begin = !predicate(*this->_begin) ? end : this->_begin;
             }
         }
 
@@ -44,27 +39,10 @@ namespace lz {
          * @param end The ending of the iterator.
          */
         Take(const Iterator begin, const Iterator end, std::nullptr_t) :
-            _begin(begin),
-            _end(end) {
+            detail::BasicIteratorView<iterator>(begin, end) {
         }
 
         Take() = default;
-
-        /**
-         * @brief Returns the beginning of the iterator.
-         * @return The beginning of the iterator.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * @brief Returns the ending of the iterator.
-         * @return The ending of the iterator.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
 
     // Start of group
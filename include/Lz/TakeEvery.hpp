@@ -16,10 +16,6 @@ namespace lz {
 
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief TakeEvery constructor.
@@ -29,27 +25,11 @@ namespace lz {
          * @param distance The distance between `begin` and `end`.
          */
         TakeEvery(const Iterator begin, const Iterator end, const std::size_t offset, typename iterator::difference_type distance) :
-            _begin(begin, end, offset, distance),
-            _end(end, end, offset, distance) {
+            detail::BasicIteratorView<iterator>(iterator(begin, offset, 0, static_cast<std::size_t>(distance)),
+                                                iterator(end, offset, static_cast<std::size_t>(distance), static_cast<std::size_t>(distance))) {
         }
 
         TakeEvery() = default;
-
-        /**
-         * @brief Returns the beginning of the iterator.
-         * @return The beginning of the iterator.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * @brief Returns the ending of the iterator.
-         * @return The ending of the iterator.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
 
     // Start of group
@@ -73,7 +53,8 @@ namespace lz {
      */
     template<class Iterator>
     TakeEvery<Iterator> takeEveryRange(const Iterator begin, const Iterator end, const std::size_t offset, const std::size_t start = 0) {
-        return TakeEvery<Iterator>(std::next(begin, start), end, offset, std::distance(begin, end));
+        const Iterator first = std::next(begin, static_cast<typename std::iterator_traits<Iterator>::difference_type>(start));
+        return TakeEvery<Iterator>(first, end, offset, std::distance(first, end));
     }
 
     /**
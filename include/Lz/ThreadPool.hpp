@@ -0,0 +1,295 @@
+#pragma once
+
+#ifndef LZ_THREAD_POOL_HPP
+#define LZ_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "detail/LzTools.hpp"
+
+
+namespace lz {
+    class ThreadPool {
+        struct TaskQueue {
+            std::mutex mutex{};
+            std::deque<std::function<void()>> tasks{};
+        };
+
+        struct Worker {
+            const ThreadPool* pool;
+            std::size_t index;
+        };
+
+        // Every thread has its own queue. It takes the tasks it submitted itself from the back, which are likely to
+        // use memory that is still cached, and steals from the front of the other queues if its own queue is empty
+        std::vector<std::unique_ptr<TaskQueue>> _queues{};
+        std::vector<std::thread> _threads{};
+        std::atomic<std::size_t> _queued{0};
+        std::atomic<std::size_t> _nextQueue{0};
+        std::mutex _sleepMutex{};
+        std::condition_variable _condition{};
+        // Signalled when a task is done or submitted, for the threads that wait for a future. Uses `_sleepMutex` as well
+        std::condition_variable _progress{};
+        std::size_t _completed = 0;
+        bool _stopping = false;
+
+        template<class Future>
+        static bool isReady(const Future& future) {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        static Worker& currentWorker() {
+            static thread_local Worker worker{nullptr, 0};
+            return worker;
+        }
+
+        bool tryPop(const std::size_t index, std::function<void()>& task) {
+            TaskQueue& queue = *_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                return false;
+            }
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        bool trySteal(const std::size_t index, std::function<void()>& task) {
+            for (std::size_t i = 1; i < _queues.size(); i++) {
+                TaskQueue& queue = *_queues[(index + i) % _queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool runTask(const std::size_t index) {
+            std::function<void()> task;
+            if (!tryPop(index, task) && !trySteal(index, task)) {
+                return false;
+            }
+            --_queued;
+            task();
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                ++_completed;
+            }
+            _progress.notify_all();
+            return true;
+        }
+
+        void work(const std::size_t index) {
+            currentWorker() = Worker{this, index};
+            while (true) {
+                if (runTask(index)) {
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _condition.wait(lock, [this] { return _stopping || _queued.load() != 0; });
+                // The remaining tasks are executed before stopping
+                if (_stopping && _queued.load() == 0) {
+                    return;
+                }
+            }
+        }
+
+        void push(std::function<void()> task) {
+            const Worker& worker = currentWorker();
+            // Tasks that are submitted from within a task stay on the same thread, unless they are stolen
+            const std::size_t index = worker.pool == this ? worker.index : _nextQueue++ % _queues.size();
+            {
+                TaskQueue& queue = *_queues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+            ++_queued;
+            {
+                // Makes sure that a thread that is about to sleep sees the new task
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+            }
+            _condition.notify_one();
+            // Threads that wait for a future can execute the new task meanwhile
+            _progress.notify_all();
+        }
+
+    public:
+        /**
+         * @brief Returns the amount of threads that is used if no amount is given: the amount of hardware threads, or 1
+         * if it cannot be determined.
+         * @return The default amount of threads.
+         */
+        static std::size_t defaultThreadCount() {
+            const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            return hardwareThreads == 0 ? 1 : hardwareThreads;
+        }
+
+        /**
+         * @brief Starts a work stealing pool of `threads` threads, that execute the submitted tasks until the pool is
+         * destroyed. One pool can be shared by several pipelines, so that the amount of threads stays under control.
+         * Does not need C++17 or `std::execution`.
+         * @param threads The amount of threads. At least one thread is started.
+         */
+        explicit ThreadPool(const std::size_t threads = defaultThreadCount()) {
+            const std::size_t count = threads == 0 ? 1 : threads;
+            _queues.reserve(count);
+            for (std::size_t i = 0; i < count; i++) {
+                _queues.emplace_back(new TaskQueue());
+            }
+            _threads.reserve(count);
+            for (std::size_t i = 0; i < count; i++) {
+                _threads.emplace_back(&ThreadPool::work, this, i);
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Executes the tasks that are still queued, and joins the threads.
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _stopping = true;
+            }
+            _condition.notify_all();
+            for (std::thread& thread : _threads) {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Returns the amount of threads of this pool.
+         * @return The amount of threads.
+         */
+        std::size_t size() const {
+            return _threads.size();
+        }
+
+        /**
+         * @brief Queues `function` to be executed by one of the threads.
+         * @tparam Function Is automatically deduced.
+         * @param function A function without parameters.
+         * @return A future of the result of `function`. If `function` throws, the exception is rethrown by the future.
+         */
+        template<class Function>
+        std::future<detail::FunctionReturnType<Function&>> submit(Function function) {
+            using Result = detail::FunctionReturnType<Function&>;
+            std::shared_ptr<std::packaged_task<Result()>> task = std::make_shared<std::packaged_task<Result()>>(std::move(function));
+            std::future<Result> future = task->get_future();
+            push([task] { (*task)(); });
+            return future;
+        }
+
+        /**
+         * @brief Executes one queued task on the calling thread, if there is one.
+         * @return Whether a task was executed.
+         */
+        bool runPendingTask() {
+            const Worker& worker = currentWorker();
+            return runTask(worker.pool == this ? worker.index : 0);
+        }
+
+        /**
+         * @brief Waits until `future` is ready, executing queued tasks in the meantime. Unlike `future.wait()`, this
+         * cannot deadlock if it is called from within a task of this pool, e.g. by nested parallel algorithms.
+         * @tparam Future Is automatically deduced. Either `std::future` or `std::shared_future`.
+         * @param future The future of a task of this pool to wait for.
+         */
+        template<class Future>
+        void wait(const Future& future) {
+            while (!isReady(future)) {
+                if (runPendingTask()) {
+                    continue;
+                }
+                // The task of `future` signals `_progress` under the lock once it is done, so it cannot be missed
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                const std::size_t completed = _completed;
+                _progress.wait(lock, [this, completed, &future] {
+                    return _completed != completed || _queued.load() != 0 || isReady(future);
+                });
+            }
+        }
+    };
+
+    /**
+     * @brief Executes parallel algorithms on an `lz::ThreadPool`, as an alternative to `std::execution::par`, which is
+     * available without C++17 and TBB. Use `lz::par(pool)` to create one.
+     */
+    class Par {
+        ThreadPool* _pool;
+
+    public:
+        explicit Par(ThreadPool& pool) :
+            _pool(&pool) {
+        }
+
+        ThreadPool& pool() const {
+            return *_pool;
+        }
+    };
+
+    /**
+     * @brief Returns an executor that runs parallel algorithms on `pool`, e.g. `lz::indexOf(values, 5, lz::par(pool))`
+     * or `lz::map(values, f).toVector(lz::par(pool))`.
+     * @param pool The pool to use. Must outlive the algorithm.
+     * @return An executor that uses `pool`.
+     */
+    inline Par par(ThreadPool& pool) {
+        return Par(pool);
+    }
+
+    namespace detail {
+        // Splits [0, size) into a few chunks per thread and calls `function(chunkBegin, chunkEnd)` on the pool for every
+        // chunk. Returns when all chunks are done, rethrowing the first exception if any
+        template<class Function>
+        void forEachChunk(const Par& executor, const std::size_t size, const Function& function) {
+            if (size == 0) {
+                return;
+            }
+            ThreadPool& pool = executor.pool();
+            const std::size_t chunks = std::min(size, 4 * pool.size());
+            std::vector<std::future<void>> futures;
+            futures.reserve(chunks);
+            for (std::size_t i = 0; i < chunks; i++) {
+                const std::size_t chunkBegin = size * i / chunks;
+                const std::size_t chunkEnd = size * (i + 1) / chunks;
+                futures.push_back(pool.submit([&function, chunkBegin, chunkEnd] { function(chunkBegin, chunkEnd); }));
+            }
+            // The chunks refer to `function`, so all of them must be done before an exception is rethrown
+            for (const std::future<void>& future : futures) {
+                pool.wait(future);
+            }
+            for (std::future<void>& future : futures) {
+                future.get();
+            }
+        }
+
+        template<>
+        struct ExecutorTraits<Par> {
+            static constexpr bool isExecutor = true;
+
+            template<class Function>
+            static void forEachChunk(const Par& executor, const std::size_t size, const Function& function) {
+                detail::forEachChunk(executor, size, function);
+            }
+        };
+    }
+}
+
+#endif
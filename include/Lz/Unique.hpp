@@ -10,25 +10,21 @@
 
 namespace lz {
 #ifdef LZ_HAS_EXECUTION
-    template<class Execution, LZ_CONCEPT_ITERATOR Iterator>
-    class Unique final : public detail::BasicIteratorView<detail::UniqueIterator<Execution, Iterator>> {
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Projection = detail::Identity>
+    class Unique final : public detail::BasicIteratorView<detail::UniqueIterator<Execution, Iterator, Projection>> {
 #else
-    template<LZ_CONCEPT_ITERATOR Iterator>
-    class Unique final : public detail::BasicIteratorView<detail::UniqueIterator<Iterator>> {
+    template<LZ_CONCEPT_ITERATOR Iterator, class Projection = detail::Identity>
+    class Unique final : public detail::BasicIteratorView<detail::UniqueIterator<Iterator, Projection>> {
 #endif
     public:
 #ifdef LZ_HAS_EXECUTION
-        using iterator = detail::UniqueIterator<Execution, Iterator>;
+        using iterator = detail::UniqueIterator<Execution, Iterator, Projection>;
 #else
-        using iterator = detail::UniqueIterator<Iterator>;
+        using iterator = detail::UniqueIterator<Iterator, Projection>;
 #endif
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin{};
-        iterator _end{};
-
     public:
         /**
          * @brief Creates an Unique iterator view object.
@@ -36,36 +32,19 @@ namespace lz {
          * implemented.
          * @param begin The beginning of the sequence.
          * @param end The ending of the sequence.
+         * @param projection The projection of which the values must be unique. By default, the values themselves.
          */
 #ifdef LZ_HAS_EXECUTION
-        Unique(const Iterator begin, const Iterator end, const Execution e) :
-            _begin(begin, end, e),
-            _end(end, end, e) {
+        Unique(const Iterator begin, const Iterator end, const Projection& projection, const Execution e) :
+            detail::BasicIteratorView<iterator>(iterator(begin, begin, end, projection, e), iterator(end, begin, end, projection, e)) {
         }
 #else
-        Unique(const Iterator begin, const Iterator end) :
-            _begin(begin, end),
-            _end(end, end) {
+        Unique(const Iterator begin, const Iterator end, const Projection& projection = Projection()) :
+            detail::BasicIteratorView<iterator>(iterator(begin, begin, end, projection), iterator(end, begin, end, projection)) {
         }
 #endif
 
         Unique() = default;
-
-        /**
-         * @brief Returns the beginning of the sequence.
-         * @return The beginning of the sequence.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
-
-        /**
-         * @brief Returns the ending of the sequence.
-         * @return The ending of the sequence.
-         */
-        iterator end() const override {
-            return _end;
-        }
     };
 
     // Start of group
@@ -76,7 +55,8 @@ namespace lz {
 
 #ifdef LZ_HAS_EXECUTION
     /**
-     * @brief Returns an Unique iterator view object.
+     * @brief Returns an Unique iterator view object, which is bidirectional if the iterator is bidirectional, forward
+     * otherwise.
      * @details Use this iterator view to eventually get an iterator of unique values. The operator< and operator== must be implemented.
      * @tparam Iterator Is automatically deduced.
      * @tparam Execution Is automatically deduced.
@@ -86,15 +66,38 @@ namespace lz {
      * element are done using this policy.
      * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, detail::EnableIfPolicy<Execution> = 0>
     LZ_REQUIRES_LESS_THAN(Iterator, Iterator)
     Unique<Execution, Iterator> uniqueRange(const Iterator begin, const Iterator end, const Execution execPolicy = std::execution::seq) {
         detail::verifyIteratorAndPolicies(execPolicy, begin);
-        return Unique<Execution, Iterator>(begin, end, execPolicy);
+        return Unique<Execution, Iterator>(begin, end, detail::Identity(), execPolicy);
+    }
+
+    /**
+     * @brief Returns an Unique iterator view object, of which the projections of the values are unique, e.g.
+     * `lz::uniqueRange(people.begin(), people.end(), &Person::name)` yields one person per name.
+     * @details The sequence is sorted by its projections, so the operator< and operator== of the projection must be implemented.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @tparam Execution Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param projection The member or function to project every element with.
+     * @param execPolicy The execution policy. Must be one of `std::execution`'s tags. The sorting check, sorting and finding the adjacent
+     * element are done using this policy.
+     * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Projection,
+        detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    Unique<Execution, Iterator, detail::Projection<Projection>>
+    uniqueRange(const Iterator begin, const Iterator end, const Projection projection, const Execution execPolicy = std::execution::seq) {
+        detail::verifyIteratorAndPolicies(execPolicy, begin);
+        return Unique<Execution, Iterator, detail::Projection<Projection>>(begin, end, projection, execPolicy);
     }
 #else
     /**
-     * @brief Returns an Unique iterator view object.
+     * @brief Returns an Unique iterator view object, which is bidirectional if the iterator is bidirectional, forward
+     * otherwise.
      * @details Use this iterator view to eventually get an iterator of unique values. The operator< and operator== must be implemented.
      * @tparam Iterator Is automatically deduced.
      * @param begin The beginning of the sequence.
@@ -106,11 +109,28 @@ namespace lz {
     Unique<Iterator> uniqueRange(const Iterator begin, const Iterator end) {
         return Unique<Iterator>(begin, end);
     }
+
+    /**
+     * @brief Returns an Unique iterator view object, of which the projections of the values are unique, e.g.
+     * `lz::uniqueRange(people.begin(), people.end(), &Person::name)` yields one person per name.
+     * @details The sequence is sorted by its projections, so the operator< and operator== of the projection must be implemented.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param projection The member or function to project every element with.
+     * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator, class Projection>
+    Unique<Iterator, detail::Projection<Projection>> uniqueRange(const Iterator begin, const Iterator end, const Projection projection) {
+        return Unique<Iterator, detail::Projection<Projection>>(begin, end, projection);
+    }
 #endif
 
 #ifdef LZ_HAS_EXECUTION
     /**
-     * @brief Returns an Unique iterator view object.
+     * @brief Returns an Unique iterator view object, which is bidirectional if the iterator is bidirectional, forward
+     * otherwise.
      * @details Use this iterator view to eventually get an iterator of unique values. The operator< and operator== must be implemented.
      * @tparam Iterator Is automatically deduced.
      * @tparam Execution Is automatically deduced.
@@ -120,14 +140,36 @@ namespace lz {
      * element are done using this policy.
      * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
      */
-    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class It = detail::IterType<Iterable>>
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class It = detail::IterType<Iterable>,
+        detail::EnableIfPolicy<Execution> = 0>
     LZ_REQUIRES_LESS_THAN(It, It)
     Unique<Execution, It> unique(Iterable&& iterable, const Execution execPolicy = std::execution::seq) {
         return uniqueRange(std::begin(iterable), std::end(iterable), execPolicy);
     }
+
+    /**
+     * @brief Returns an Unique iterator view object, of which the projections of the values are unique, e.g.
+     * `lz::unique(people, &Person::name)` yields one person per name.
+     * @details The sequence is sorted by its projections, so the operator< and operator== of the projection must be implemented.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @tparam Execution Is automatically deduced.
+     * @param iterable The iterable sequence.
+     * @param projection The member or function to project every element with.
+     * @param execPolicy The execution policy. Must be one of `std::execution`'s tags. The sorting check, sorting and finding the adjacent
+     * element are done using this policy.
+     * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : unique(...))` fashion.
+     */
+    template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Projection,
+        class It = detail::IterType<Iterable>, detail::EnableIfPolicy<Execution> = 0, detail::EnableIfNotPolicy<Projection> = 0>
+    Unique<Execution, It, detail::Projection<Projection>>
+    unique(Iterable&& iterable, const Projection projection, const Execution execPolicy = std::execution::seq) {
+        return uniqueRange(std::begin(iterable), std::end(iterable), projection, execPolicy);
+    }
 #else
     /**
-     * @brief Returns an Unique iterator view object.
+     * @brief Returns an Unique iterator view object, which is bidirectional if the iterator is bidirectional, forward
+     * otherwise.
      * @details Use this iterator view to eventually get an iterator of unique values. The operator< and operator== must be implemented.
      * @tparam Iterable Is automatically deduced.
      * @param iterable The iterable sequence.
@@ -138,6 +180,21 @@ namespace lz {
     Unique<It> unique(Iterable&& iterable) {
         return uniqueRange(std::begin(iterable), std::end(iterable));
     }
+
+    /**
+     * @brief Returns an Unique iterator view object, of which the projections of the values are unique, e.g.
+     * `lz::unique(people, &Person::name)` yields one person per name.
+     * @details The sequence is sorted by its projections, so the operator< and operator== of the projection must be implemented.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Projection Is automatically deduced. A pointer to a data member or a function with one parameter.
+     * @param iterable The iterable sequence.
+     * @param projection The member or function to project every element with.
+     * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : unique(...))` fashion.
+     */
+    template<LZ_CONCEPT_ITERABLE Iterable, class Projection, class It = detail::IterType<Iterable>>
+    Unique<It, detail::Projection<Projection>> unique(Iterable&& iterable, const Projection projection) {
+        return uniqueRange(std::begin(iterable), std::end(iterable), projection);
+    }
 #endif
 
     // End of group
@@ -9,16 +9,21 @@
 
 namespace lz {
     template<LZ_CONCEPT_ITERATOR... Iterators>
-    class Zip final : public detail::BasicIteratorView<detail::ZipIterator<Iterators...>> {
+    class Zip final : public detail::BasicIteratorView<detail::ZipIteratorFor<Iterators...>> {
     public:
-        using iterator = detail::ZipIterator<Iterators...>;
+        using iterator = detail::ZipIteratorFor<Iterators...>;
         using const_iterator = iterator;
 
         using value_type = typename iterator::value_type;
 
-    private:
-        iterator _begin;
-        iterator _end{};
+        LZ_CONSTEXPR_CXX_17 Zip(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end, std::true_type /* isRandomAccess */) :
+            detail::BasicIteratorView<iterator>(iterator(begin, 0),
+                                                iterator(begin, detail::smallestLength(detail::MakeIndexSequence<sizeof...(Iterators)>(), begin, end))) {
+        }
+
+        LZ_CONSTEXPR_CXX_17 Zip(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end, std::false_type /* isRandomAccess */) :
+            detail::BasicIteratorView<iterator>(iterator(begin), iterator(end)) {
+        }
 
     public:
         /**
@@ -31,30 +36,35 @@ namespace lz {
          * unless the iterator is const, making it a const reference.
          * to alter the values in the iterator (and therefore also the container/iterable), unless the iterator is const,
          * making it a const reference.
+         * If all the iterators are random access, the length of the smallest container is calculated once and the
+         * iterators only keep track of a shared index.
          * @param begin The beginning of all the containers
          * @param end The ending of all the containers
          */
-        explicit Zip(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end) :
-            _begin(begin),
-            _end(end) {
+        LZ_CONSTEXPR_CXX_17 explicit Zip(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end) :
+            Zip(begin, end, detail::IsAllRandomAccess<Iterators...>()) {
         }
 
         Zip() = default;
 
-        /**
-         * @brief Returns the beginning of the zip iterator.
-         * @return The beginning of the zip iterator.
-         */
-        iterator begin() const override {
-            return _begin;
-        }
+
 
         /**
-         * @brief Returns the ending of the zip iterator.
-         * @return The ending of the zip iterator.
+         * @brief Creates a structure of arrays of the sequence: every element of the tuples is stored in its own
+         * `std::vector`. The vectors are reserved up front with the size of this view.
+         * @details Example:
+         * ```cpp
+         * std::vector<int> a = {1, 2, 3};
+         * std::vector<float> b = {1.f, 2.f, 3.f};
+         * std::tuple<std::vector<int>, std::vector<float>> columns = lz::zip(a, b).toColumns();
+         * ```
+         * @return A `std::tuple<std::vector<Iterators::value_type>...>` where the n-th vector contains the n-th
+         * elements of the tuples.
          */
-        iterator end() const override {
-            return _end;
+        std::tuple<std::vector<typename std::iterator_traits<Iterators>::value_type>...> toColumns() const {
+            std::tuple<std::vector<typename std::iterator_traits<Iterators>::value_type>...> columns;
+            detail::unzipInto(detail::MakeIndexSequence<sizeof...(Iterators)>(), this->_begin, this->_end, columns);
+            return columns;
         }
     };
 
@@ -65,7 +75,7 @@ namespace lz {
      */
 
     template<LZ_CONCEPT_ITERATOR... Iterators>
-    Zip<Iterators...> zipRange(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end) {
+    LZ_CONSTEXPR_CXX_17 Zip<Iterators...> zipRange(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end) {
         return Zip<Iterators...>(begin, end);
     }
 
@@ -82,7 +92,7 @@ namespace lz {
      * `for (auto tuple :  lz::zip(...))`.
      */
     template<LZ_CONCEPT_ITERABLE... Iterables>
-    Zip<detail::IterType<Iterables>...> zip(Iterables&& ... iterables) {
+    LZ_CONSTEXPR_CXX_17 Zip<detail::IterType<Iterables>...> zip(Iterables&& ... iterables) {
         return zipRange(std::make_tuple(std::begin(iterables)...), std::make_tuple(std::end(iterables)...));
     }
 
@@ -5,6 +5,8 @@
 
 #include <iterator>
 
+#include "LzTools.hpp"
+
 
 namespace lz { namespace detail {
     template<class Exception, class Iterator, class Function>
@@ -21,7 +23,7 @@ namespace lz { namespace detail {
     private:
         Iterator _iterator{};
         Exception _exception{};
-        Function _function{};
+        LZ_NO_UNIQUE_ADDRESS Function _function{};
 
     public:
         AffirmIterator(const Iterator iterator, const Function& function, Exception exception) :
@@ -0,0 +1,161 @@
+#pragma once
+
+#ifndef LZ_ASYNC_MAP_ITERATOR_HPP
+#define LZ_ASYNC_MAP_ITERATOR_HPP
+
+#include <deque>
+#include <future>
+#include <iterator>
+#include <memory>
+
+#include "LzTools.hpp"
+#include "../ThreadPool.hpp"
+
+
+namespace lz { namespace detail {
+    template<class Iterator, class Function>
+    class AsyncMapState {
+        using ValueType = typename std::iterator_traits<Iterator>::value_type;
+
+    public:
+        using Result = Decay<FunctionReturnType<const Function&, const ValueType&>>;
+
+    private:
+        // The element is copied on the consuming thread, so that the upstream sequence is never evaluated concurrently
+        class Task {
+            const Function* _function;
+            ValueType _value;
+
+        public:
+            Task(const Function* function, ValueType value) :
+                _function(function),
+                _value(std::move(value)) {
+            }
+
+            Result operator()() const {
+                return (*_function)(_value);
+            }
+        };
+
+        Iterator _iterator;
+        Iterator _end;
+        Function _function;
+        std::unique_ptr<ThreadPool> _ownedPool{};
+        ThreadPool* _pool;
+        std::size_t _window;
+        // The results of the submitted elements, in the order of the sequence
+        std::deque<std::shared_future<Result>> _pending{};
+
+        void fill() {
+            while (_pending.size() < _window && _iterator != _end) {
+                _pending.push_back(_pool->submit(Task(&_function, *_iterator)).share());
+                ++_iterator;
+            }
+        }
+
+        // Uses `pool` if it is given, otherwise the pool that is owned
+        AsyncMapState(const Iterator begin, const Iterator end, const Function& function, std::unique_ptr<ThreadPool> ownedPool,
+                      ThreadPool* pool, const std::size_t window) :
+            _iterator(begin),
+            _end(end),
+            _function(function),
+            _ownedPool(std::move(ownedPool)),
+            _pool(pool != nullptr ? pool : _ownedPool.get()),
+            _window(window == 0 ? 2 * _pool->size() : window) {
+        }
+
+    public:
+        AsyncMapState(const Iterator begin, const Iterator end, const Function& function, ThreadPool& pool,
+                      const std::size_t window) :
+            AsyncMapState(begin, end, function, nullptr, &pool, window) {
+        }
+
+        AsyncMapState(const Iterator begin, const Iterator end, const Function& function, const std::size_t workers,
+                      const std::size_t window) :
+            AsyncMapState(begin, end, function, std::unique_ptr<ThreadPool>(new ThreadPool(workers)), nullptr, window) {
+        }
+
+        AsyncMapState(const AsyncMapState&) = delete;
+
+        AsyncMapState& operator=(const AsyncMapState&) = delete;
+
+        // The tasks refer to the function, so they must be finished before it is destroyed. The pool executes queued
+        // tasks while waiting, so that a view that is read within a task of its own pool cannot deadlock
+        ~AsyncMapState() {
+            for (const std::shared_future<Result>& result : _pending) {
+                _pool->wait(result);
+            }
+        }
+
+        const Result& current() {
+            fill();
+            _pool->wait(_pending.front());
+            return _pending.front().get();
+        }
+
+        void next() {
+            fill();
+            _pending.pop_front();
+            fill();
+        }
+
+        bool done() {
+            fill();
+            return _pending.empty();
+        }
+    };
+
+    template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+    class AsyncMapIterator {
+        using State = AsyncMapState<Iterator, Function>;
+
+        std::shared_ptr<State> _state{};
+
+        bool isEnd() const {
+            return _state == nullptr || _state->done();
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename State::Result;
+        using difference_type = std::ptrdiff_t;
+        using reference = const value_type&;
+        using pointer = const value_type*;
+
+        explicit AsyncMapIterator(std::shared_ptr<State> state) :
+            _state(std::move(state)) {
+        }
+
+        AsyncMapIterator() = default;
+
+        reference operator*() const {
+            return _state->current();
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        AsyncMapIterator& operator++() {
+            _state->next();
+            return *this;
+        }
+
+        // Copies of an input iterator share their position, so the old element is returned by value instead
+        PostIncrementProxy<value_type> operator++(int) {
+            PostIncrementProxy<value_type> old(**this);
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const AsyncMapIterator& other) const {
+            return isEnd() == other.isEnd();
+        }
+
+        bool operator!=(const AsyncMapIterator& other) const {
+            return !(*this == other);
+        }
+    };
+}}
+
+#endif
@@ -10,54 +10,196 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
 
 #include "fmt/ostream.h"
 #include "LzTools.hpp"
 
 
+namespace lz {
+    /**
+     * @brief Whether `into` appends the sequence to the container, or replaces the contents of the container.
+     */
+    enum class IntoMode {
+        Append,
+        Overwrite
+    };
+}
+
 namespace lz { namespace detail {
     // ReSharper disable once CppUnnamedNamespaceInHeaderFile
     namespace {
-        template<typename T>
-        struct HasReserve {
-        private:
-            template<typename U, std::size_t(U::*)() const>
-            struct SubstituteFailure {
-            };
-
-            template<typename U>
-            static char test(SubstituteFailure<U, &U::reserve>*) {
-                return 0;
-            }
+        template<class T, class = void>
+        struct HasReserve : std::false_type {
+        };
 
-            template<typename U>
-            static int test(...) {
-                return 0;
-            }
-        	
-        public:
-            static const bool value = sizeof(test<T>(nullptr)) == sizeof(char);
+        template<class T>
+        struct HasReserve<T, decltype(void(std::declval<T&>().reserve(std::size_t())))> : std::true_type {
         };
 
 #ifdef LZ_HAS_CXX14
         template<class T>
         constexpr bool HasReserveV = HasReserve<T>::value;
 #endif // end has cxx 14
+
+        template<class T, class = void>
+        struct HasCapacity : std::false_type {
+        };
+
+        template<class T>
+        struct HasCapacity<T, decltype(void(std::declval<const T&>().capacity()))> : std::true_type {
+        };
+    }
+
+    // Containers that are appended to in batches keep growing geometrically, instead of being reallocated to exactly the
+    // new size for every batch
+    template<class Container>
+    EnableIf<HasCapacity<Container>::value, void> reserveAppended(Container& container, const std::size_t count) {
+        const std::size_t size = container.size() + count;
+        if (size > container.capacity()) {
+            container.reserve((std::max)(size, 2 * container.capacity()));
+        }
+    }
+
+    // E.g. unordered containers, that only rehash if they need more buckets
+    template<class Container>
+    EnableIf<!HasCapacity<Container>::value, void> reserveAppended(Container& container, const std::size_t count) {
+        container.reserve(container.size() + count);
+    }
+
+    // Only reserve if the size of the sequence can be calculated in O(1), otherwise the sequence would be evaluated twice
+    template<class Container, class Iterator>
+    EnableIf<HasReserve<Container>::value && IsRandomAccess<Iterator>::value, void>
+    reserveFor(Container& container, const Iterator begin, const Iterator end) {
+        reserveAppended(container, static_cast<std::size_t>(std::distance(begin, end)));
+    }
+
+    template<class Container, class Iterator>
+    EnableIf<!(HasReserve<Container>::value && IsRandomAccess<Iterator>::value), void>
+    reserveFor(Container&, const Iterator, const Iterator) {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+    template<class Iterator>
+    struct IsContiguous : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {
+    };
+#else
+    // Views such as take, slice and dropWhile use the iterator of the underlying container, so these are the
+    // iterators that can be recognized as contiguous without std::contiguous_iterator
+    template<class Iterator, class T = ValueTypeIterator<Iterator>>
+    struct IsContiguous : std::integral_constant<bool,
+        std::is_pointer<Iterator>::value ||
+        (!std::is_same<T, bool>::value && (std::is_same<Iterator, typename std::vector<T>::iterator>::value ||
+                                           std::is_same<Iterator, typename std::vector<T>::const_iterator>::value)) ||
+        std::is_same<Iterator, std::string::iterator>::value || std::is_same<Iterator, std::string::const_iterator>::value> {
+    };
+#endif // end has concepts
+
+    template<class Container, class Iterator, class T = ValueTypeIterator<Iterator>>
+    struct IsBulkCopyable : std::integral_constant<bool,
+        IsContiguous<Iterator>::value && std::is_trivially_copyable<T>::value && HasMutableData<Container>::value &&
+        std::is_same<typename Container::value_type, T>::value> {
+    };
+
+    // Contiguous sequences of trivially copyable types are appended with a single memcpy instead of element by element
+    template<class Container, class Iterator>
+    EnableIf<IsBulkCopyable<Container, Iterator>::value, void>
+    copyInto(Container& container, const Iterator begin, const Iterator end) {
+        const auto size = static_cast<std::size_t>(end - begin);
+        if (size == 0) {
+            return;
+        }
+        const std::size_t offset = container.size();
+        container.resize(offset + size);
+        std::memcpy(container.data() + offset, std::addressof(*begin), size * sizeof(typename Container::value_type));
+    }
+
+    template<class Container, class Iterator>
+    EnableIf<!IsBulkCopyable<Container, Iterator>::value, void>
+    copyInto(Container& container, const Iterator begin, const Iterator end) {
+        reserveFor(container, begin, end);
+        std::copy(begin, end, std::inserter(container, container.end()));
+    }
+
+    // Like copyInto, sumOf and minMaxOf are called unqualified, so that iterators that can calculate the result without
+    // visiting every element (e.g. in closed form) can provide a hidden friend with the same signature
+    template<class Iterator>
+    EnableIf<!IsContiguous<Iterator>::value || std::is_pointer<Iterator>::value, ValueTypeIterator<Iterator>>
+    sumOf(Iterator begin, const Iterator end) {
+        ValueTypeIterator<Iterator> sum = ValueTypeIterator<Iterator>();
+        for (; begin != end; ++begin) {
+            sum += *begin;
+        }
+        return sum;
+    }
+
+    // Contiguous sequences are summed over plain pointers, which compilers can vectorize
+    template<class Iterator>
+    EnableIf<IsContiguous<Iterator>::value && !std::is_pointer<Iterator>::value, ValueTypeIterator<Iterator>>
+    sumOf(const Iterator begin, const Iterator end) {
+        if (begin == end) {
+            return ValueTypeIterator<Iterator>();
+        }
+        const auto* first = std::addressof(*begin);
+        return sumOf(first, first + (end - begin));
+    }
+
+    // The sequence must not be empty. Every element is dereferenced once, and the iterators are not assigned, so that
+    // iterators that store a lambda can be used as well
+    template<class Iterator>
+    std::pair<ValueTypeIterator<Iterator>, ValueTypeIterator<Iterator>> minMaxOf(Iterator begin, const Iterator end) {
+        ValueTypeIterator<Iterator> first = *begin;
+        std::pair<ValueTypeIterator<Iterator>, ValueTypeIterator<Iterator>> minMax(first, first);
+        for (++begin; begin != end; ++begin) {
+            auto&& value = *begin;
+            if (value < minMax.first) {
+                minMax.first = value;
+            }
+            else if (minMax.second < value) {
+                minMax.second = value;
+            }
+        }
+        return minMax;
+    }
+
+    // std::copy is only constexpr since C++20
+    template<class Iterator, class OutputIterator>
+    LZ_CONSTEXPR_CXX_17 void copyRange(Iterator begin, const Iterator end, OutputIterator output) {
+        for (; begin != end; ++begin, ++output) {
+            *output = *begin;
+        }
+    }
+
+    template<class Iterator, class Outputs, std::size_t... I>
+    void unzipInto(IndexSequence<I...>, Iterator begin, const Iterator end, Outputs&& outputs) {
+        // Reserved like `into`, so that outputs that are reused for every batch keep growing geometrically
+        const std::initializer_list<int> reserveExpand = {(reserveFor(std::get<I>(outputs), begin, end), 0)...};
+        static_cast<void>(reserveExpand);
+
+        for (; begin != end; ++begin) {
+            auto&& row = *begin;
+            const std::initializer_list<int> expand = {
+                (std::get<I>(outputs).insert(std::get<I>(outputs).end(), std::get<I>(row)), 0)...};
+            static_cast<void>(expand);
+        }
     }
 
     template<class Iterator>
     class BasicIteratorView {
         template<class MapType, class Allocator, class KeySelectorFunc>
         MapType createMap(const KeySelectorFunc keyGen, const Allocator& allocator) const {
+            const Projection<KeySelectorFunc> project(keyGen);
             MapType map(allocator);
-            std::transform(begin(), end(), std::inserter(map, map.end()), [keyGen](const value_type& value) {
-                return std::make_pair(keyGen(value), value);
+            std::transform(begin(), end(), std::inserter(map, map.end()), [project](const value_type& value) {
+                return std::make_pair(project(value), value);
             });
             return map;
         }
 
         template<std::size_t N>
-        void verifyRange() const {
+        LZ_CONSTEXPR_CXX_17 void verifyRange() const {
             constexpr auto size = static_cast<typename std::iterator_traits<Iterator>::difference_type>(N);
 
             if (std::distance(begin(), end()) > size) {
@@ -66,13 +208,10 @@ namespace lz { namespace detail {
         }
 
         template<class Container>
-        EnableIf<HasReserve<Container>::value, void> reserve(Container& container) const {
-            container.reserve(std::distance(begin(), end()));
+        void reserve(Container& container) const {
+            reserveFor(container, begin(), end());
         }
 
-        template<class Container>
-        EnableIf<!HasReserve<Container>::value, void> reserve(Container&) const {}
-
 #ifdef LZ_HAS_EXECUTION
 
         template<class Container, class... Args, class Execution>
@@ -80,15 +219,15 @@ namespace lz { namespace detail {
             const Iterator b = begin();
             const Iterator e = end();
             Container cont(std::forward<Args>(args)...);
-            reserve(cont);
 
-            // Prevent static assertion
-            if constexpr (IsSequencedPolicyV<Execution>) {
+            // Prevent static assertion. A bulk copy is at memory bandwidth already, so it is not done in parallel
+            if constexpr (IsSequencedPolicyV<Execution> || IsBulkCopyable<Container, Iterator>::value) {
                 static_cast<void>(execution);
                 // If parallel execution, compilers throw an error if it's std::execution::seq. Use an output iterator to fill the contents.
-                std::copy(b, e, std::inserter(cont, cont.begin()));
+                copyInto(cont, b, e);
             }
             else {
+                reserve(cont);
                 std::copy(std::forward<Execution>(execution), b, e, cont.begin());
             }
 
@@ -102,8 +241,7 @@ namespace lz { namespace detail {
             const Iterator b = begin();
             const Iterator e = end();
             Container cont(std::forward<Args>(args)...);
-            reserve(cont);
-            std::copy(b, e, std::inserter(cont, cont.begin()));
+            copyInto(cont, b, e);
             return cont;
         }
 
@@ -113,18 +251,19 @@ namespace lz { namespace detail {
         using value_type = typename std::iterator_traits<Iterator>::value_type;
 
     private:
+        // The key selector may also be a pointer to a data member, e.g. `toMap(&Person::name)`
         template<class KeySelectorFunc>
-        using KeyType = FunctionReturnType<KeySelectorFunc, value_type>;
+        using KeyType = Decay<FunctionReturnType<const Projection<KeySelectorFunc>&, const value_type&>>;
 
 #ifdef LZ_HAS_EXECUTION
 
         template<std::size_t N, class Execution>
-        std::array<value_type, N> copyArray(Execution execution) const {
+        LZ_CONSTEXPR_CXX_17 std::array<value_type, N> copyArray(Execution execution) const {
             verifyRange<N>();
             std::array<value_type, N> array{};
 
             if constexpr (IsSequencedPolicyV<Execution>) {
-                std::copy(begin(), end(), array.begin());
+                copyRange(begin(), end(), array.begin());
             }
             else {
                 std::copy(std::forward<Execution>(execution), begin(), end(), array.begin());
@@ -135,23 +274,155 @@ namespace lz { namespace detail {
 #else // ^^^ has execution vvv ! has execution
 
         template<std::size_t N>
-        std::array<value_type, N> copyArray() const {
+        LZ_CONSTEXPR_CXX_17 std::array<value_type, N> copyArray() const {
             verifyRange<N>();
             std::array<value_type, N> array{};
-            std::copy(begin(), end(), array.begin());
+            copyRange(begin(), end(), array.begin());
             return array;
         }
 
 #endif // end has execution
 
-    public:
-        virtual Iterator begin() const = 0;
+        template<class OutputIterator, class Executor>
+        OutputIterator copyToParallel(OutputIterator output, const Executor& executor, std::true_type /* random access */) const {
+            using Difference = typename std::iterator_traits<Iterator>::difference_type;
+            using OutputDifference = typename std::iterator_traits<OutputIterator>::difference_type;
+
+            const Iterator b = begin();
+            const std::size_t size = static_cast<std::size_t>(end() - b);
+            ExecutorTraits<Executor>::forEachChunk(executor, size, [b, output](const std::size_t chunkBegin,
+                                                                               const std::size_t chunkEnd) {
+                std::copy(b + static_cast<Difference>(chunkBegin), b + static_cast<Difference>(chunkEnd),
+                          output + static_cast<OutputDifference>(chunkBegin));
+            });
+            return output + static_cast<OutputDifference>(size);
+        }
+
+        template<class OutputIterator, class Executor>
+        OutputIterator copyToParallel(OutputIterator output, const Executor&, std::false_type /* random access */) const {
+            return std::copy(begin(), end(), output);
+        }
+
+        template<class Executor>
+        std::vector<value_type> toVectorParallel(const Executor& executor, std::true_type /* random access */) const {
+            std::vector<value_type> vector(static_cast<std::size_t>(end() - begin()));
+            copyToParallel(vector.begin(), executor, std::true_type());
+            return vector;
+        }
+
+        template<class Executor>
+        std::vector<value_type> toVectorParallel(const Executor&, std::false_type /* random access */) const {
+            std::vector<value_type> vector;
+            copyInto(vector, begin(), end());
+            return vector;
+        }
+
+        // Every chunk is formatted into a string of its own, and the strings are concatenated in order
+        template<class Executor>
+        std::string toStringParallel(const std::string& delimiter, const Executor& executor, std::true_type /* random access */) const {
+            using Difference = typename std::iterator_traits<Iterator>::difference_type;
+
+            const Iterator b = begin();
+            std::mutex mutex;
+            std::vector<std::pair<std::size_t, std::string>> chunks;
+            ExecutorTraits<Executor>::forEachChunk(executor, static_cast<std::size_t>(end() - b), [b, &delimiter, &mutex, &chunks](
+                const std::size_t chunkBegin, const std::size_t chunkEnd) {
+                std::string chunk;
+                for (std::size_t i = chunkBegin; i < chunkEnd; i++) {
+                    chunk += fmt::format("{}{}", *(b + static_cast<Difference>(i)), delimiter);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                chunks.emplace_back(chunkBegin, std::move(chunk));
+            });
+            std::sort(chunks.begin(), chunks.end(), [](const std::pair<std::size_t, std::string>& a,
+                                                       const std::pair<std::size_t, std::string>& other) {
+                return a.first < other.first;
+            });
+
+            std::size_t length = 0;
+            for (const std::pair<std::size_t, std::string>& chunk : chunks) {
+                length += chunk.second.size();
+            }
+            std::string string;
+            string.reserve(length);
+            for (const std::pair<std::size_t, std::string>& chunk : chunks) {
+                string += chunk.second;
+            }
+            if (!string.empty() && !delimiter.empty()) {
+                string.erase(string.size() - delimiter.size());
+            }
+            return string;
+        }
+
+        template<class Executor>
+        std::string toStringParallel(const std::string& delimiter, const Executor&, std::false_type /* random access */) const {
+            return toString(delimiter);
+        }
 
-        virtual Iterator end() const = 0;
+    protected:
+        Iterator _begin{};
+        Iterator _end{};
+
+    public:
+        /**
+         * @brief Creates a view of [begin, end).
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         */
+        LZ_CONSTEXPR_CXX_17 BasicIteratorView(Iterator begin, Iterator end) :
+            _begin(std::move(begin)),
+            _end(std::move(end)) {
+        }
 
         BasicIteratorView() = default;
 
-        virtual ~BasicIteratorView() = default;
+        /**
+         * @brief Returns the beginning of the sequence. Views that need to search for their first element, such as
+         * `filter`, `except`, `unique` and `dropWhile`, do so once when they are created, so this is always O(1).
+         * @return The beginning of the sequence.
+         */
+        LZ_CONSTEXPR_CXX_17 Iterator begin() const {
+            return _begin;
+        }
+
+        /**
+         * @brief Returns the ending of the sequence.
+         * @return The ending of the sequence.
+         */
+        LZ_CONSTEXPR_CXX_17 Iterator end() const {
+            return _end;
+        }
+
+        /**
+         * @brief Splits the sequence into about `parts` consecutive, non-empty views that can be iterated
+         * independently, e.g. on different threads. Every part uses the same iterator type as this view, so the whole
+         * pipeline is executed by each part. Random access sequences are split by index, `concatenate` by segment
+         * (every non-empty segment is at least one part), `split` after a delimiter, and `filter` and `map` by
+         * splitting their source. Other forward sequences are split by walking them once, and input sequences are
+         * not split.
+         * @param parts The preferred amount of parts.
+         * @return The parts, in order. Empty if the sequence is empty.
+         */
+        std::vector<BasicIteratorView<Iterator>> split(const std::size_t parts) const {
+            std::vector<BasicIteratorView<Iterator>> views;
+            for (const std::pair<Iterator, Iterator>& range : splitRange(begin(), end(), parts)) {
+                views.emplace_back(range.first, range.second);
+            }
+            return views;
+        }
+
+        /**
+         * @brief Returns a view over the elements [from, to) of this sequence. This is O(1) if the iterator is random
+         * access, and O(to) otherwise.
+         * @param from The index of the first element.
+         * @param to The index past the last element. Must not be smaller than `from`, nor bigger than the size.
+         * @return A view over the elements [from, to).
+         */
+        BasicIteratorView<Iterator> subrange(const std::size_t from, const std::size_t to) const {
+            using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+            const Iterator first = std::next(begin(), static_cast<DifferenceType>(from));
+            return BasicIteratorView<Iterator>(first, std::next(first, static_cast<DifferenceType>(to - from)));
+        }
 
 #ifdef LZ_HAS_EXECUTION
 
@@ -194,7 +465,7 @@ namespace lz { namespace detail {
         * @return A `std::vector<value_type>` with the sequence.
         */
         template<class Execution = std::execution::sequenced_policy>
-        std::vector<value_type> toVector(const Execution exec = std::execution::seq) const {
+        EnableIf<!IsExecutor<Execution>::value, std::vector<value_type>> toVector(const Execution exec = std::execution::seq) const {
             return to<std::vector>(exec);
         }
 
@@ -218,10 +489,12 @@ namespace lz { namespace detail {
          * @tparam N The size of the array.
          * @param exec The execution policy. Must be one of `std::execution`'s tags.
          * @return A new `std::array<value_type, N>`.
+         * @details If C++17 or higher is used, this function can be used in constant expressions, as long as the
+         * iterators of this view can as well.
          * @throws `std::out_of_range` if the size of the iterator is bigger than `N`.
          */
         template<std::size_t N, class Execution = std::execution::sequenced_policy>
-        std::array<value_type, N> toArray(const Execution exec = std::execution::seq) const {
+        LZ_CONSTEXPR_CXX_17 std::array<value_type, N> toArray(const Execution exec = std::execution::seq) const {
             return copyArray<N>(exec);
         }
 
@@ -233,7 +506,8 @@ namespace lz { namespace detail {
          * @return The converted iterator in string format.
          */
         template<class Execution = std::execution::sequenced_policy>
-        std::string toString(const std::string& delimiter = "", const Execution exec = std::execution::seq) const {
+        EnableIf<!IsExecutor<Execution>::value, std::string>
+        toString(const std::string& delimiter = "", const Execution exec = std::execution::seq) const {
             static_assert(IsParallelPolicyV<Execution> || IsSequencedPolicyV<Execution>,
                           "This function cannot be vectorized. Prefer to use std::execution::par/seq.");
 
@@ -301,7 +575,7 @@ namespace lz { namespace detail {
          * @return A new `std::vector<value_type, Allocator>`.
          */
         template<class Allocator>
-        std::vector<value_type, Allocator> toVector(const Allocator& alloc = Allocator()) const {
+        EnableIf<!IsExecutor<Allocator>::value, std::vector<value_type, Allocator>> toVector(const Allocator& alloc = Allocator()) const {
             return to<std::vector>(alloc);
         }
 
@@ -309,10 +583,12 @@ namespace lz { namespace detail {
          * @brief Creates a new `std::vector<value_type, N>`.
          * @tparam N The size of the array.
          * @return A new `std::array<value_type, N>`.
+         * @details If C++17 or higher is used, this function can be used in constant expressions, as long as the
+         * iterators of this view can as well.
          * @throws `std::out_of_range` if the size of the iterator is bigger than `N`.
          */
         template<std::size_t N>
-        std::array<value_type, N> toArray() const {
+        LZ_CONSTEXPR_CXX_17 std::array<value_type, N> toArray() const {
             return copyArray<N>();
         }
 
@@ -356,7 +632,8 @@ namespace lz { namespace detail {
          * @tparam KeySelectorFunc Is automatically deduced.
          * @tparam Compare Can be used for the STL `std::map` ordering, default is `std::less<Key>`.
          * @tparam Allocator Can be used for the STL `std::map` allocator. Default is `std::allocator`.
-         * @param keyGen The function that returns the key for the dictionary, and takes a `value_type` as parameter.
+         * @param keyGen The function that returns the key for the dictionary, and takes a `value_type` as parameter, or a
+         * pointer to a data member of `value_type`.
          * @param allocator Optional, can be used for using a custom allocator.
          * @return A `std::map<Key, value_type[, Compare[, Allocator]]>`
          */
@@ -387,7 +664,8 @@ namespace lz { namespace detail {
          * @tparam Hasher The hash function, `std::hash<Key>` is used by default
          * @tparam KeyEquality Key equality checker. `std::equal_to<Key>` is used by default.
          * @tparam Allocator Can be used for the STL `std::map` allocator. Default is `std::allocator`.
-         * @param keyGen The function that returns the key for the dictionary, and takes a `value_type` as parameter.
+         * @param keyGen The function that returns the key for the dictionary, and takes a `value_type` as parameter, or a
+         * pointer to a data member of `value_type`.
          * @param allocator Optional, can be used for using a custom allocator.
          * @return A `std::unordered_map<Key, value_type[, Hasher[, KeyEquality[, Allocator]]]>`
          */
@@ -401,6 +679,236 @@ namespace lz { namespace detail {
             return createMap<UnorderedMap>(keyGen, allocator);
         }
 
+        /**
+         * @brief Splits a sequence of tuples or pairs into several containers, evaluating the sequence only once. Every
+         * n-th element of the tuple/pair is appended to the n-th container. The containers are reserved up front if the
+         * size of the sequence can be calculated in O(1).
+         * @details Example:
+         * ```cpp
+         * std::vector<int> indexes;
+         * std::vector<std::string> values;
+         * lz::enumerate(strings).unzipTo(indexes, values);
+         * ```
+         * @tparam Containers Is automatically deduced. Must have an `insert(iterator, value)` method, like STL containers.
+         * @param containers The containers to append the elements to. The amount of containers must be equal to the size of
+         * the tuple/pair.
+         */
+        template<class... Containers>
+        void unzipTo(Containers& ... containers) const {
+            static_assert(std::tuple_size<value_type>::value == sizeof...(Containers),
+                          "the amount of containers must be equal to the size of the tuple");
+            unzipInto(MakeIndexSequence<sizeof...(Containers)>(), begin(), end(), std::tuple<Containers&...>(containers...));
+        }
+
+        /**
+         * @brief Appends the sequence to an existing container, or replaces its contents if `mode` is
+         * `lz::IntoMode::Overwrite`. The capacity of the container is reused, and it is reserved only once if the size
+         * of the sequence can be calculated in O(1), so that filling the same container batch after batch does not
+         * allocate once it is large enough.
+         * @details Example:
+         * ```cpp
+         * std::vector<int> batch;
+         * for (...) {
+         *     lz::map(input, f).into(batch, lz::IntoMode::Overwrite);
+         * }
+         * ```
+         * @tparam Container Is automatically deduced. Must have an `insert(iterator, value)` method, like STL containers.
+         * @param container The container to fill.
+         * @param mode Whether to append to the container or to overwrite its contents.
+         * @return The container, by reference.
+         */
+        template<class Container>
+        Container& into(Container& container, const IntoMode mode = IntoMode::Append) const {
+            if (mode == IntoMode::Overwrite) {
+                container.clear();
+            }
+            copyInto(container, begin(), end());
+            return container;
+        }
+
+#ifdef LZ_HAS_EXECUTION
+        /**
+         * @brief Copies the sequence to an output iterator, e.g. a pointer into a preallocated buffer.
+         * @tparam OutputIterator Is automatically deduced.
+         * @param output The beginning of the destination.
+         * @param execution The execution policy. Must be one of `std::execution`'s tags.
+         * @return The output iterator past the last copied element.
+         */
+        template<class OutputIterator, class Execution = std::execution::sequenced_policy>
+        EnableIf<!IsExecutor<Execution>::value, OutputIterator>
+        copyTo(OutputIterator output, const Execution execution = std::execution::seq) const {
+            if constexpr (IsSequencedPolicyV<Execution>) {
+                return std::copy(begin(), end(), output);
+            }
+            else {
+                static_assert(IsForwardOrStrongerV<OutputIterator> && IsForwardOrStrongerV<Iterator>,
+                              "Both iterator types must be forward iterator or higher. Use std::execution::seq instead.");
+                return std::copy(execution, begin(), end(), output);
+            }
+        }
+#else // ^^^ has execution vvv ! has execution
+        /**
+         * @brief Copies the sequence to an output iterator, e.g. a pointer into a preallocated buffer.
+         * @tparam OutputIterator Is automatically deduced.
+         * @param output The beginning of the destination.
+         * @return The output iterator past the last copied element.
+         */
+        template<class OutputIterator>
+        OutputIterator copyTo(OutputIterator output) const {
+            return std::copy(begin(), end(), output);
+        }
+#endif // end has execution
+
+        /**
+         * @brief Copies the sequence to an output iterator, using the threads of `executor`. The copy is only done in
+         * parallel if both iterator types are random access, and the elements must be safe to read concurrently.
+         * @tparam OutputIterator Is automatically deduced.
+         * @tparam Executor Is automatically deduced.
+         * @param output The beginning of the destination.
+         * @param executor The executor created by `lz::par(pool)`.
+         * @return The output iterator past the last copied element.
+         */
+        template<class OutputIterator, class Executor>
+        EnableIf<IsExecutor<Executor>::value, OutputIterator> copyTo(OutputIterator output, const Executor& executor) const {
+            return copyToParallel(output, executor, IsAllRandomAccess<Iterator, OutputIterator>());
+        }
+
+        /**
+         * @brief Creates a new `std::vector<value_type>` of the sequence, using the threads of `executor`, e.g.
+         * `lz::map(values, parse).toVector(lz::par(pool))`. The elements are only computed in parallel if the iterator
+         * is random access and `value_type` is default constructible, otherwise this is the same as `toVector()`.
+         * @tparam Executor Is automatically deduced.
+         * @param executor The executor created by `lz::par(pool)`.
+         * @return A `std::vector<value_type>` with the sequence.
+         */
+        template<class Executor>
+        EnableIf<IsExecutor<Executor>::value, std::vector<value_type>> toVector(const Executor& executor) const {
+            return toVectorParallel(executor, std::integral_constant<bool, IsRandomAccess<Iterator>::value &&
+                                                                              std::is_default_constructible<value_type>::value>());
+        }
+
+        /**
+         * @brief Converts the sequence to a string with a given delimiter, formatting the elements with the threads of
+         * `executor`, e.g. `lz::range(4).toString(", ", lz::par(pool))` yields 0, 1, 2, 3. The elements are only
+         * formatted in parallel if the iterator is random access, otherwise this is the same as `toString(delimiter)`.
+         * @tparam Executor Is automatically deduced.
+         * @param delimiter The delimiter between the previous value and the next.
+         * @param executor The executor created by `lz::par(pool)`.
+         * @return The converted sequence in string format.
+         */
+        template<class Executor>
+        EnableIf<IsExecutor<Executor>::value, std::string> toString(const std::string& delimiter, const Executor& executor) const {
+            return toStringParallel(delimiter, executor, IsRandomAccess<Iterator>());
+        }
+
+        /**
+         * @brief Returns the amount of elements in the sequence. This is O(1) if the iterator is random access.
+         * @return The amount of elements in the sequence.
+         */
+        std::size_t count() const {
+            return static_cast<std::size_t>(std::distance(begin(), end()));
+        }
+
+        /**
+         * @brief Adds all elements to a value initialized `value_type` using `operator+=`, e.g. `lz::range(5).sum() == 10`.
+         * Ranges of integers and repeated arithmetic values are summed in O(1).
+         * @return The sum of the sequence, or a value initialized `value_type` if the sequence is empty.
+         */
+        value_type sum() const {
+            return sumOf(begin(), end());
+        }
+
+        /**
+         * @brief Returns the smallest element of the sequence, using `operator<`.
+         * @throws std::invalid_argument if the sequence is empty.
+         * @return The smallest element.
+         */
+        value_type min() const {
+            return minMax().first;
+        }
+
+        /**
+         * @brief Returns the largest element of the sequence, using `operator<`.
+         * @throws std::invalid_argument if the sequence is empty.
+         * @return The largest element.
+         */
+        value_type max() const {
+            return minMax().second;
+        }
+
+        /**
+         * @brief Returns the smallest and the largest element of the sequence in one pass, using `operator<`. Ranges of
+         * integers and repeated values are calculated in O(1).
+         * @throws std::invalid_argument if the sequence is empty.
+         * @return A pair with the smallest element as `first` and the largest element as `second`.
+         */
+        std::pair<value_type, value_type> minMax() const {
+            if (begin() == end()) {
+                throw std::invalid_argument(LZ_FILE_LINE ": the sequence cannot be empty");
+            }
+            return minMaxOf(begin(), end());
+        }
+
+        /**
+         * @brief Checks whether `predicate` returns true for any element. Stops at the first element for which it does.
+         * @tparam UnaryPredicate Is automatically deduced.
+         * @param predicate A function that takes a `value_type` and returns a bool.
+         * @return Whether `predicate` returns true for any element, false if the sequence is empty.
+         */
+        template<class UnaryPredicate>
+        bool any(const UnaryPredicate predicate) const {
+            return std::any_of(begin(), end(), predicate);
+        }
+
+        /**
+         * @brief Checks whether `predicate` returns true for all elements. Stops at the first element for which it does not.
+         * @tparam UnaryPredicate Is automatically deduced.
+         * @param predicate A function that takes a `value_type` and returns a bool.
+         * @return Whether `predicate` returns true for all elements, true if the sequence is empty.
+         */
+        template<class UnaryPredicate>
+        bool all(const UnaryPredicate predicate) const {
+            return std::all_of(begin(), end(), predicate);
+        }
+
+        /**
+         * @brief Returns the first element of the sequence, without evaluating the rest.
+         * @throws std::invalid_argument if the sequence is empty.
+         * @return The first element, by value.
+         */
+        value_type first() const {
+            const Iterator first = begin();
+            if (first == end()) {
+                throw std::invalid_argument(LZ_FILE_LINE ": the sequence cannot be empty");
+            }
+            return *first;
+        }
+
+        /**
+         * @brief Folds the sequence from left to right, for as long as `predicate` returns true for the result so far.
+         * The elements after that are not evaluated.
+         * @details Example:
+         * ```cpp
+         * // Adds the sizes of the files until the sum exceeds the limit
+         * std::size_t size = lz::map(files, getSize).foldWhile(std::size_t(0), std::plus<std::size_t>(),
+         *                                                      [limit](std::size_t s) { return s <= limit; });
+         * ```
+         * @tparam T Is automatically deduced.
+         * @tparam BinaryOp Is automatically deduced.
+         * @tparam UnaryPredicate Is automatically deduced.
+         * @param init The initial value.
+         * @param binaryOp A function that takes the result so far and an element, and returns the new result.
+         * @param predicate A function that takes the result so far, and returns whether to continue.
+         * @return The result of the fold.
+         */
+        template<class T, class BinaryOp, class UnaryPredicate>
+        T foldWhile(T init, const BinaryOp binaryOp, const UnaryPredicate predicate) const {
+            for (Iterator it = begin(); it != end() && predicate(static_cast<const T&>(init)); ++it) {
+                init = binaryOp(std::move(init), *it);
+            }
+            return init;
+        }
+
         /**
          * Function to stream the iterator to an output stream e.g. `std::cout`.
          * @param o The stream object.
@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef LZ_CACHE_ITERATOR_HPP
+#define LZ_CACHE_ITERATOR_HPP
+
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    // Holds the computed elements. Element `index` is stored in slot `index % capacity`, every slot remembers which
+    // element it holds, so that forward sequences can reuse the slots of the elements that were passed already
+    template<class T>
+    class CacheStorage {
+        class Slot {
+            static constexpr std::size_t Empty = std::numeric_limits<std::size_t>::max();
+
+            std::size_t _index = Empty;
+            alignas(T) unsigned char _storage[sizeof(T)];
+
+            T* get() {
+                return reinterpret_cast<T*>(_storage);
+            }
+
+            void reset() {
+                if (_index != Empty) {
+                    get()->~T();
+                    _index = Empty;
+                }
+            }
+
+        public:
+            Slot() = default;
+
+            Slot(const Slot&) = delete;
+
+            Slot& operator=(const Slot&) = delete;
+
+            ~Slot() {
+                reset();
+            }
+
+            template<class Iterator>
+            const T& fetch(const std::size_t index, const Iterator& iterator) {
+                if (_index != index) {
+                    reset();
+                    ::new (static_cast<void*>(_storage)) T(*iterator);
+                    _index = index;
+                }
+                return *get();
+            }
+        };
+
+        std::vector<Slot> _slots;
+
+    public:
+        explicit CacheStorage(const std::size_t capacity) :
+            _slots(capacity == 0 ? 1 : capacity) {
+        }
+
+        template<class Iterator>
+        const T& fetch(const std::size_t index, const Iterator& iterator) {
+            return _slots[index % _slots.size()].fetch(index, iterator);
+        }
+    };
+
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    class CacheIterator {
+        using IterTraits = std::iterator_traits<Iterator>;
+
+    public:
+        // Elements are identified by their distance to the beginning, which is unknown for the end of bidirectional
+        // sequences, so these cannot go backwards
+        using iterator_category = Conditional<IsRandomAccess<Iterator>::value, std::random_access_iterator_tag, std::forward_iterator_tag>;
+        using value_type = typename IterTraits::value_type;
+        using difference_type = typename IterTraits::difference_type;
+        // Other sequences reuse the slots, so that two iterators `window` apart share one. These return a copy of the
+        // stored element, which stays valid when the slot is reused
+        using reference = Conditional<IsRandomAccess<Iterator>::value, const value_type&, value_type>;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        Iterator _iterator{};
+        std::size_t _index{};
+        std::shared_ptr<CacheStorage<value_type>> _storage{};
+
+    public:
+        CacheIterator(const Iterator iterator, const std::size_t index, std::shared_ptr<CacheStorage<value_type>> storage) :
+            _iterator(iterator),
+            _index(index),
+            _storage(std::move(storage)) {
+        }
+
+        CacheIterator() = default;
+
+        reference operator*() const {
+            return _storage->fetch(_index, _iterator);
+        }
+
+        pointer operator->() const {
+            return FakePointerProxy<reference>(**this);
+        }
+
+        CacheIterator& operator++() {
+            ++_iterator;
+            ++_index;
+            return *this;
+        }
+
+        CacheIterator operator++(int) {
+            CacheIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        CacheIterator& operator--() {
+            --_iterator;
+            --_index;
+            return *this;
+        }
+
+        CacheIterator operator--(int) {
+            CacheIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        CacheIterator& operator+=(const difference_type offset) {
+            _iterator += offset;
+            _index += static_cast<std::size_t>(offset);
+            return *this;
+        }
+
+        CacheIterator& operator-=(const difference_type offset) {
+            _iterator -= offset;
+            _index -= static_cast<std::size_t>(offset);
+            return *this;
+        }
+
+        CacheIterator operator+(const difference_type offset) const {
+            CacheIterator tmp(*this);
+            tmp += offset;
+            return tmp;
+        }
+
+        CacheIterator operator-(const difference_type offset) const {
+            CacheIterator tmp(*this);
+            tmp -= offset;
+            return tmp;
+        }
+
+        difference_type operator-(const CacheIterator& other) const {
+            return _iterator - other._iterator;
+        }
+
+        reference operator[](const difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        bool operator==(const CacheIterator& other) const {
+            return _iterator == other._iterator;
+        }
+
+        bool operator!=(const CacheIterator& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const CacheIterator& other) const {
+            return _iterator < other._iterator;
+        }
+
+        bool operator>(const CacheIterator& other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const CacheIterator& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const CacheIterator& other) const {
+            return !(*this < other);
+        }
+    };
+}}
+
+#endif
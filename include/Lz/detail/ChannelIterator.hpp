@@ -0,0 +1,237 @@
+#pragma once
+
+#ifndef LZ_CHANNEL_ITERATOR_HPP
+#define LZ_CHANNEL_ITERATOR_HPP
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "LzTools.hpp"
+#include "RingBuffer.hpp"
+
+
+namespace lz { namespace detail {
+    template<class T>
+    class ChannelState {
+        MpmcRingBuffer<T> _buffer;
+        std::atomic<bool> _closed{false};
+        // The pushes that may still write, so that a consumer can tell whether a closed channel is drained. Both
+        // atomics are sequentially consistent: a push either sees the channel closed, or is counted when a consumer
+        // checks
+        std::atomic<std::size_t> _pushing{0};
+
+        bool isDrained() const {
+            return _closed.load() && _pushing.load() == 0;
+        }
+
+    public:
+        explicit ChannelState(const std::size_t capacity) :
+            _buffer(capacity) {
+        }
+
+        std::size_t capacity() const {
+            return _buffer.capacity();
+        }
+
+        bool isClosed() const {
+            return _closed.load();
+        }
+
+        void close() {
+            _closed.store(true);
+        }
+
+        // Moves at most `count` elements from `first` into the channel, if it is not closed
+        std::size_t tryPush(T* first, const std::size_t count) {
+            _pushing.fetch_add(1);
+            const std::size_t pushed = _closed.load() ? 0 : _buffer.tryPush(first, count);
+            _pushing.fetch_sub(1);
+            return pushed;
+        }
+
+        // Waits for room until `count` elements from `first` are moved into the channel, or until it is closed
+        std::size_t push(T* first, const std::size_t count) {
+            std::size_t pushed = 0;
+            for (std::size_t attempt = 0; pushed != count;) {
+                const std::size_t moved = tryPush(first + pushed, count - pushed);
+                if (moved != 0) {
+                    pushed += moved;
+                    attempt = 0;
+                }
+                else if (isClosed()) {
+                    break;
+                }
+                else {
+                    backOff(attempt++);
+                }
+            }
+            return pushed;
+        }
+
+        template<class Function>
+        std::size_t tryPop(Function consume, const std::size_t count) {
+            return _buffer.tryPop(consume, count);
+        }
+
+        // Waits until at least one element is passed to `consume`. Returns 0 if the channel is closed and drained
+        template<class Function>
+        std::size_t pop(Function consume, const std::size_t count) {
+            for (std::size_t attempt = 0;; attempt++) {
+                const std::size_t popped = _buffer.tryPop(consume, count);
+                if (popped != 0) {
+                    return popped;
+                }
+                if (isDrained()) {
+                    // The elements of the last pushes are visible now
+                    return _buffer.tryPop(consume, count);
+                }
+                backOff(attempt);
+            }
+        }
+    };
+
+    // The read position of one consumer. Copies of an iterator share the cursor, and the cursor only pops when an
+    // element is read, so that e.g. `std::next(begin, amount)` does not pop any element
+    template<class T>
+    class ChannelCursor {
+        using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        std::shared_ptr<ChannelState<T>> _state;
+        Slot _current{};
+        // The index of the element in `_current`, or of the next element to pop if nothing is loaded
+        std::size_t _position = 0;
+        bool _loaded = false;
+
+        T* current() {
+            return reinterpret_cast<T*>(&_current);
+        }
+
+    public:
+        explicit ChannelCursor(std::shared_ptr<ChannelState<T>> state) :
+            _state(std::move(state)) {
+        }
+
+        ChannelCursor(const ChannelCursor&) = delete;
+
+        ChannelCursor& operator=(const ChannelCursor&) = delete;
+
+        ~ChannelCursor() {
+            if (_loaded) {
+                current()->~T();
+            }
+        }
+
+        std::size_t position() const {
+            return _position;
+        }
+
+        // Drops the element at `position` once it is read and incremented past, so that an iterator that is created
+        // afterwards starts at the next element
+        void release(const std::size_t position) {
+            if (_loaded && _position == position) {
+                current()->~T();
+                _loaded = false;
+                _position++;
+            }
+        }
+
+        // Returns the element at `position`, or nullptr if the channel is drained before. The elements before it are
+        // dropped, positions that were read already return the current element
+        T* at(const std::size_t position) {
+            while (true) {
+                if (!_loaded) {
+                    T* slot = current();
+                    const auto moveToSlot = [slot](T& value) {
+                        ::new(static_cast<void*>(slot)) T(std::move(value));
+                    };
+                    _loaded = _state->pop(moveToSlot, 1) != 0;
+                    if (!_loaded) {
+                        return nullptr;
+                    }
+                }
+                if (_position >= position) {
+                    return current();
+                }
+                current()->~T();
+                _loaded = false;
+                _position++;
+            }
+        }
+    };
+
+    template<class T>
+    class ChannelIterator {
+        using Cursor = ChannelCursor<T>;
+
+        std::shared_ptr<Cursor> _cursor{};
+        std::size_t _position = 0;
+        // Comparing loads the element as well, but only reading it consumes it
+        mutable bool _read = false;
+
+        std::size_t position() const {
+            return _position < _cursor->position() ? _cursor->position() : _position;
+        }
+
+        bool isEnd() const {
+            return _cursor == nullptr || _cursor->at(position()) == nullptr;
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using pointer = T*;
+
+        explicit ChannelIterator(std::shared_ptr<Cursor> cursor) :
+            _cursor(std::move(cursor)) {
+        }
+
+        ChannelIterator() = default;
+
+        reference operator*() const {
+            _read = true;
+            return *_cursor->at(position());
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        ChannelIterator& operator++() {
+            const std::size_t current = position();
+            if (_read) {
+                _cursor->release(current);
+                _read = false;
+            }
+            _position = current + 1;
+            return *this;
+        }
+
+        PostIncrementProxy<value_type> operator++(int) {
+            PostIncrementProxy<value_type> old(**this);
+            ++*this;
+            return old;
+        }
+
+        // Iterators of the same cursor at different positions are equal if the channel is drained before the first one
+        bool operator==(const ChannelIterator& other) const {
+            if (_cursor == nullptr || _cursor != other._cursor) {
+                return isEnd() && other.isEnd();
+            }
+            if (position() == other.position()) {
+                return true;
+            }
+            return position() < other.position() ? isEnd() : other.isEnd();
+        }
+
+        bool operator!=(const ChannelIterator& other) const {
+            return !(*this == other);
+        }
+    };
+}}
+
+#endif
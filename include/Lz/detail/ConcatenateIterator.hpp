@@ -159,10 +159,12 @@ namespace lz { namespace detail {
         };
 
 
+        // The remaining offset is always inside the last segment
         template<class Tuple, std::size_t I>
         struct PlusIs<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
             template<class DifferenceType>
-            void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
+            void operator()(Tuple& iterators, const Tuple& /*end*/, const DifferenceType offset) const {
+                std::get<I>(iterators) = std::next(std::get<I>(iterators), offset);
             }
         };
     } // anonymous namespace
@@ -192,6 +194,56 @@ namespace lz { namespace detail {
             return std::accumulate(totals.begin(), totals.end(), static_cast<difference_type>(0));
         }
 
+        template<std::size_t J>
+        TupleElement<J, IterTuple> segmentIterator(const TupleElement<J, IterTuple>& position, std::integral_constant<int, 0>) const {
+            return position;
+        }
+
+        template<std::size_t J, class Position>
+        TupleElement<J, IterTuple> segmentIterator(const Position&, std::integral_constant<int, -1> /* before */) const {
+            return std::get<J>(_end);
+        }
+
+        template<std::size_t J, class Position>
+        TupleElement<J, IterTuple> segmentIterator(const Position&, std::integral_constant<int, 1> /* after */) const {
+            return std::get<J>(_begin);
+        }
+
+        // The iterators of the segments before segment I are at their end, and the ones after it at their beginning
+        template<std::size_t I, std::size_t... J>
+        IterTuple positionIn(IndexSequence<J...>, const TupleElement<I, IterTuple>& position) const {
+            return IterTuple(segmentIterator<J>(position, std::integral_constant<int, (J < I ? -1 : (J == I ? 0 : 1))>())...);
+        }
+
+        template<std::size_t I>
+        int splitSegment(IteratorRanges<ConcatenateIterator>& ranges, const ConcatenateIterator& end, const std::size_t parts) const {
+            using Segment = TupleElement<I, IterTuple>;
+            using Indices = MakeIndexSequence<sizeof...(Iterators)>;
+
+            for (const std::pair<Segment, Segment>& range : splitRange(std::get<I>(_iterators), std::get<I>(end._iterators), parts)) {
+                ranges.emplace_back(ConcatenateIterator(positionIn<I>(Indices(), range.first), _begin, _end),
+                                    ConcatenateIterator(positionIn<I>(Indices(), range.second), _begin, _end));
+            }
+            return 0;
+        }
+
+        // Every segment is split on its own, in proportion to its size, so that no part crosses a segment boundary
+        template<std::size_t... I>
+        IteratorRanges<ConcatenateIterator> split(IndexSequence<I...>, const ConcatenateIterator& end, const std::size_t parts) const {
+            const std::size_t sizes[] = {
+                static_cast<std::size_t>(std::distance(std::get<I>(_iterators), std::get<I>(end._iterators)))...};
+            const std::size_t total = std::accumulate(std::begin(sizes), std::end(sizes), static_cast<std::size_t>(0));
+
+            IteratorRanges<ConcatenateIterator> ranges;
+            if (total == 0) {
+                return ranges;
+            }
+            const std::initializer_list<int> expand = {
+                splitSegment<I>(ranges, end, sizes[I] == 0 ? 0 : std::max(parts * sizes[I] / total, static_cast<std::size_t>(1)))...};
+            static_cast<void>(expand);
+            return ranges;
+        }
+
     public:
         ConcatenateIterator(const IterTuple& iterators, const IterTuple& begin, const IterTuple& end) :  // NOLINT(modernize-pass-by-value)
             _iterators(iterators),
@@ -284,6 +336,11 @@ namespace lz { namespace detail {
         bool operator>=(const ConcatenateIterator& other) const {
             return !(*this < other);
         }
+
+        friend IteratorRanges<ConcatenateIterator> splitRange(const ConcatenateIterator& begin, const ConcatenateIterator& end,
+                                                              const std::size_t parts) {
+            return begin.split(MakeIndexSequence<sizeof...(Iterators)>(), end, parts);
+        }
     };
 }}
 
@@ -21,14 +21,14 @@ namespace lz { namespace detail {
         using reference = std::pair<IntType, typename IterTraits::reference>;
         using pointer = FakePointerProxy<reference>;
 
-        EnumerateIterator(const IntType start, const Iterator iterator) :
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator(const IntType start, const Iterator iterator) :
             _index(start),
             _iterator(iterator) {
         }
 
         EnumerateIterator() = default;
 
-        reference operator*() const {
+        LZ_CONSTEXPR_CXX_17 reference operator*() const {
             return reference(_index, *_iterator);
         }
 
@@ -36,83 +36,83 @@ namespace lz { namespace detail {
             return FakePointerProxy<decltype(**this)>(**this);
         }
 
-        EnumerateIterator& operator++() {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator& operator++() {
             ++_index;
             ++_iterator;
             return *this;
         }
 
-        EnumerateIterator operator++(int) {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator operator++(int) {
             EnumerateIterator tmp = *this;
             ++*this;
             return tmp;
         }
 
-        EnumerateIterator& operator--() {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator& operator--() {
             --_index;
             --_iterator;
             return *this;
         }
 
-        EnumerateIterator operator--(int) {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator operator--(int) {
             EnumerateIterator tmp(*this);
             --*this;
             return tmp;
         }
 
-        EnumerateIterator& operator+=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator& operator+=(const difference_type offset) {
             _index += static_cast<IntType>(offset);
             _iterator += offset;
             return *this;
         }
 
-        EnumerateIterator operator+(const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator operator+(const difference_type offset) const {
             EnumerateIterator tmp(*this);
             tmp += offset;
             return tmp;
         }
 
-        EnumerateIterator& operator-=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator& operator-=(const difference_type offset) {
             _index -= static_cast<IntType>(offset);
             _iterator -= offset;
             return *this;
         }
 
-        EnumerateIterator operator-(const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_17 EnumerateIterator operator-(const difference_type offset) const {
             EnumerateIterator tmp(*this);
             tmp -= offset;
             return tmp;
         }
 
-        difference_type operator-(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 difference_type operator-(const EnumerateIterator& other) const {
             return _iterator - other._iterator;
         }
 
-        reference operator[](const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_17 reference operator[](const difference_type offset) const {
             return *(*this + offset);
         }
 
-        bool operator==(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator==(const EnumerateIterator& other) const {
             return !(*this != other);
         }
 
-        bool operator!=(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator!=(const EnumerateIterator& other) const {
             return _iterator != other._iterator;
         }
 
-        bool operator<(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator<(const EnumerateIterator& other) const {
             return _iterator < other._iterator;
         }
 
-        bool operator>(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator>(const EnumerateIterator& other) const {
             return other < *this;
         }
 
-        bool operator<=(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator<=(const EnumerateIterator& other) const {
             return !(other < *this);
         }
 
-        bool operator>=(const EnumerateIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator>=(const EnumerateIterator& other) const {
             return !(*this < other);
         }
     };
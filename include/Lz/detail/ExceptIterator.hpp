@@ -6,6 +6,8 @@
 
 #include <algorithm>
 
+#include "LzTools.hpp"
+
 
 namespace lz {
 #ifdef LZ_HAS_EXECUTION
@@ -29,7 +31,7 @@ namespace lz {
             using IterTraits = std::iterator_traits<Iterator>;
 
         public:
-            using iterator_category = std::forward_iterator_tag;
+            using iterator_category = BidirectionalOrForwardTag<Iterator>;
             using value_type = typename IterTraits::value_type;
             using difference_type = typename IterTraits::difference_type;
             using pointer = typename IterTraits::pointer;
@@ -37,28 +39,28 @@ namespace lz {
 
         private:
             Iterator _iterator{};
-            Iterator _end{};
+            LZ_NO_UNIQUE_ADDRESS SentinelType<Iterator> _end{};
             IteratorToExcept _toExceptBegin{};
             IteratorToExcept _toExceptEnd{};
             bool _isSorted{};
 #ifdef LZ_HAS_EXECUTION
-            Execution _execution{};
+            LZ_NO_UNIQUE_ADDRESS Execution _execution{};
 #endif // end has execution
 
             void find() {
 #ifdef LZ_HAS_EXECUTION
-                if constexpr (IsSequencedPolicyV<Execution>) {
-                    _iterator = std::find_if(_iterator, _end, [this](const value_type& value) {
-                            return !std::binary_search(_toExceptBegin, _toExceptEnd, value);
-                    });
-                }
-                else {
+                if constexpr (!IsSequencedPolicyV<Execution> && std::is_same_v<SentinelType<Iterator>, Iterator>) {
                     _iterator = std::find_if(_execution, _iterator, _end, [this](const value_type& value) {
                         return !std::binary_search(_toExceptBegin, _toExceptEnd, value);
                    });
                 }
+                else {
+                    advanceUntil(_iterator, _end, [this](const value_type& value) {
+                            return !std::binary_search(_toExceptBegin, _toExceptEnd, value);
+                    });
+                }
 #else // ^^^ has execution vvv ! has execution
-                _iterator = std::find_if(_iterator, _end, [this](const value_type& value) {
+                advanceUntil(_iterator, _end, [this](const value_type& value) {
                     return !std::binary_search(_toExceptBegin, _toExceptEnd, value);
                 });
 #endif // end has execution
@@ -75,7 +77,7 @@ namespace lz {
                 const IteratorToExcept toExceptEnd) :
 #endif // end has execution
                 _iterator(begin),
-                _end(end),
+                _end(toSentinel(end)),
                 _toExceptBegin(toExceptBegin),
                 _toExceptEnd(toExceptEnd)
 #ifdef LZ_HAS_EXECUTION
@@ -109,7 +111,7 @@ namespace lz {
 
             ExceptIterator& operator++() {
                 ++_iterator;
-                if (_iterator != _end) {
+                if (!isAtEnd(_iterator, _end)) {
                     find();
                 }
                 return *this;
@@ -121,13 +123,36 @@ namespace lz {
                 return tmp;
             }
 
+            ExceptIterator& operator--() {
+                // The beginning of an except view always points to an element that is not excepted, so the search
+                // backwards cannot go past it
+                do {
+                    --_iterator;
+                } while (std::binary_search(_toExceptBegin, _toExceptEnd, *_iterator));
+                return *this;
+            }
+
+            ExceptIterator operator--(int) {
+                ExceptIterator tmp(*this);
+                --*this;
+                return tmp;
+            }
+
             bool operator!=(const ExceptIterator& other) const {
-                return _iterator != other._end;
+                return _iterator != other._iterator;
             }
 
             bool operator==(const ExceptIterator& other) const {
                 return !(*this != other);
             }
+
+            friend SentinelType<Iterator> toSentinel(const ExceptIterator& end) {
+                return toSentinel(end._iterator);
+            }
+
+            friend bool isAtEnd(const ExceptIterator& iterator, const SentinelType<Iterator>& end) {
+                return isAtEnd(iterator._iterator, end);
+            }
         };
     }
 }
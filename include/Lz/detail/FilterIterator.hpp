@@ -8,17 +8,49 @@
 
 #include "LzTools.hpp"
 
-namespace lz { namespace detail {
+namespace lz {
 #ifdef LZ_HAS_EXECUTION
-    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Function>
+    template<class, class, class, class>
 #else
-    template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+    template<class, class, class>
+#endif
+    class Filter;
+
+    namespace detail {
+    // Calls `First` and then `Second`, so that two adjacent filters can be executed by a single iterator
+    template<class First, class Second>
+    class ConjunctionPredicate {
+        LZ_NO_UNIQUE_ADDRESS First _first;
+        LZ_NO_UNIQUE_ADDRESS Second _second;
+
+    public:
+        LZ_CONSTEXPR_CXX_20 ConjunctionPredicate(const First& first, const Second& second) :  // NOLINT(modernize-pass-by-value)
+            _first(first),
+            _second(second) {
+        }
+
+        template<class T>
+        LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) const {
+            return _first(value) && _second(value);
+        }
+    };
+
+#ifdef LZ_HAS_EXECUTION
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Function, class Sentinel = SentinelType<Iterator>>
+#else
+    template<LZ_CONCEPT_ITERATOR Iterator, class Function, class Sentinel = SentinelType<Iterator>>
 #endif
     class FilterIterator {
         using IterTraits = std::iterator_traits<Iterator>;
 
+#ifdef LZ_HAS_EXECUTION
+        friend class Filter<Execution, Iterator, Function, Sentinel>;
+#else
+        friend class Filter<Iterator, Function, Sentinel>;
+#endif
+
     public:
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = BidirectionalOrForwardTag<Iterator>;
         using value_type = typename IterTraits::value_type;
         using difference_type = typename IterTraits::difference_type;
         using pointer = typename IterTraits::pointer;
@@ -26,41 +58,46 @@ namespace lz { namespace detail {
 
     private:
         Iterator _iterator{};
-        Iterator _end{};
-        Function _predicate;
+        LZ_NO_UNIQUE_ADDRESS Sentinel _end{};
+        LZ_NO_UNIQUE_ADDRESS Function _predicate;
 #ifdef LZ_HAS_EXECUTION
-        Execution _execution{};
+        LZ_NO_UNIQUE_ADDRESS Execution _execution{};
 #endif
 
+        // Only the beginning of a view searches for its first element, so that the end of an infinite view is not
+        // searched from
+        LZ_CONSTEXPR_CXX_20 void find() {
+#ifdef LZ_HAS_EXECUTION
+            if constexpr (IsSequencedPolicyV<Execution> || !std::is_same<Iterator, Sentinel>::value) {
+                advanceUntil(_iterator, _end, _predicate);
+            }
+            else {
+                _iterator = std::find_if(_execution, _iterator, _end, _predicate);
+            }
+#else
+            advanceUntil(_iterator, _end, _predicate);
+#endif
+        }
+
     public:
 #ifdef LZ_HAS_EXECUTION
-        FilterIterator(const Iterator begin, const Iterator end, const Function& function, const Execution execution)
+        LZ_CONSTEXPR_CXX_20 FilterIterator(const Iterator iterator, const Sentinel end, const Function& function, const Execution execution)
 #else
-        FilterIterator(const Iterator begin, const Iterator end, const Function& function)  // NOLINT(modernize-pass-by-value)
+        LZ_CONSTEXPR_CXX_20 FilterIterator(const Iterator iterator, const Sentinel end, const Function& function)  // NOLINT(modernize-pass-by-value)
 #endif
     :
-            _iterator(begin),
+            _iterator(iterator),
             _end(end),
             _predicate(function)
 #ifdef LZ_HAS_EXECUTION
             , _execution(execution)
 #endif
             {
-#ifdef LZ_HAS_EXECUTION
-            if constexpr (IsSequencedPolicyV<Execution>) {
-                _iterator = std::find_if(_iterator, _end, _predicate);
-            }
-            else {
-                _iterator = std::find_if(_execution, _iterator, _end, _predicate);
-            }
-#else
-            _iterator = std::find_if(_iterator, _end, _predicate);
-#endif
         }
 
         FilterIterator() = default;
 
-        reference operator*() const {
+        LZ_CONSTEXPR_CXX_20 reference operator*() const {
             return *_iterator;
         }
 
@@ -68,35 +105,70 @@ namespace lz { namespace detail {
             return &*_iterator;
         }
 
-        FilterIterator& operator++() {
-            if (_iterator != _end) {
-#ifdef LZ_HAS_EXECUTION
-                if constexpr (IsSequencedPolicyV<Execution>) {
-                    _iterator = std::find_if(++_iterator, _end, _predicate);
-                }
-                else {
-                    _iterator = std::find_if(_execution, ++_iterator, _end, _predicate);
-                }
-#else
-                _iterator = std::find_if(++_iterator, _end, _predicate);
-#endif
+        LZ_CONSTEXPR_CXX_20 FilterIterator& operator++() {
+            if (!isAtEnd(_iterator, _end)) {
+                ++_iterator;
+                find();
             }
             return *this;
         }
 
-        FilterIterator operator++(int) {
+        LZ_CONSTEXPR_CXX_20 FilterIterator operator++(int) {
             FilterIterator tmp(*this);
             ++*this;
             return tmp;
         }
 
-        bool operator!=(const FilterIterator& other) const {
-            return _iterator != other._end;
+        LZ_CONSTEXPR_CXX_20 FilterIterator& operator--() {
+            // The beginning of a filter view always points to an element for which the predicate returns true, so
+            // the search backwards cannot go past it
+            do {
+                --_iterator;
+            } while (!_predicate(*_iterator));
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_20 FilterIterator operator--(int) {
+            FilterIterator tmp(*this);
+            --*this;
+            return tmp;
         }
 
-        bool operator==(const FilterIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator!=(const FilterIterator& other) const {
+            return _iterator != other._iterator;
+        }
+
+        LZ_CONSTEXPR_CXX_20 bool operator==(const FilterIterator& other) const {
             return !(*this != other);
         }
+
+        friend LZ_CONSTEXPR_CXX_20 SentinelType<Iterator> toSentinel(const FilterIterator& end) {
+            return toSentinel(end._iterator);
+        }
+
+        friend LZ_CONSTEXPR_CXX_20 bool isAtEnd(const FilterIterator& iterator, const SentinelType<Iterator>& end) {
+            return isAtEnd(iterator._iterator, end);
+        }
+
+        // The source is split instead of the filtered sequence, so that the predicate is evaluated by the part that
+        // contains the element. Every part ends at the end of its source range, instead of the end of the sequence
+        friend IteratorRanges<FilterIterator> splitRange(const FilterIterator& begin, const FilterIterator& end, const std::size_t parts) {
+            IteratorRanges<FilterIterator> ranges;
+            for (const std::pair<Iterator, Iterator>& range : splitRange(begin._iterator, end._iterator, parts)) {
+#ifdef LZ_HAS_EXECUTION
+                FilterIterator first(range.first, toSentinel(range.second), begin._predicate, begin._execution);
+                FilterIterator last(range.second, toSentinel(range.second), begin._predicate, begin._execution);
+#else
+                FilterIterator first(range.first, toSentinel(range.second), begin._predicate);
+                FilterIterator last(range.second, toSentinel(range.second), begin._predicate);
+#endif
+                first.find();
+                if (first != last) {
+                    ranges.emplace_back(std::move(first), std::move(last));
+                }
+            }
+            return ranges;
+        }
     };
 }}
 
@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef LZ_FILTER_MAP_ITERATOR_HPP
+#define LZ_FILTER_MAP_ITERATOR_HPP
+
+
+#include <algorithm>
+
+#include "LzTools.hpp"
+
+namespace lz {
+#ifdef LZ_HAS_EXECUTION
+    template<class, class, class, class, class>
+#else
+    template<class, class, class, class>
+#endif
+    class FilterMap;
+
+    namespace detail {
+    // Runs a filter and a map over one pair of underlying iterators, instead of a map iterator that holds a filter
+    // iterator
+#ifdef LZ_HAS_EXECUTION
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Predicate, class Function, class Sentinel = SentinelType<Iterator>>
+#else
+    template<LZ_CONCEPT_ITERATOR Iterator, class Predicate, class Function, class Sentinel = SentinelType<Iterator>>
+#endif
+    class FilterMapIterator {
+        using FnParamType = decltype(*std::declval<const Iterator&>());
+        using FnReturnType = FunctionReturnType<Function, FnParamType>;
+
+#ifdef LZ_HAS_EXECUTION
+        friend class FilterMap<Execution, Iterator, Predicate, Function, Sentinel>;
+#else
+        friend class FilterMap<Iterator, Predicate, Function, Sentinel>;
+#endif
+
+    public:
+        using iterator_category = BidirectionalOrForwardTag<Iterator>;
+        using value_type = Decay<FnReturnType>;
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+        using reference = ReferenceIfLvalue<FnReturnType, typename std::iterator_traits<Iterator>::reference>;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        Iterator _iterator{};
+        LZ_NO_UNIQUE_ADDRESS Sentinel _end{};
+        LZ_NO_UNIQUE_ADDRESS Predicate _predicate;
+        LZ_NO_UNIQUE_ADDRESS Function _function;
+#ifdef LZ_HAS_EXECUTION
+        LZ_NO_UNIQUE_ADDRESS Execution _execution{};
+#endif
+
+        LZ_CONSTEXPR_CXX_20 void find() {
+#ifdef LZ_HAS_EXECUTION
+            if constexpr (!IsSequencedPolicyV<Execution> && std::is_same_v<Sentinel, Iterator>) {
+                _iterator = std::find_if(_execution, _iterator, _end, _predicate);
+            }
+            else {
+                advanceUntil(_iterator, _end, _predicate);
+            }
+#else
+            advanceUntil(_iterator, _end, _predicate);
+#endif
+        }
+
+    public:
+#ifdef LZ_HAS_EXECUTION
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator(const Iterator begin, const Sentinel end, const Predicate& predicate,
+                                              const Function& function, const Execution execution)
+#else
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator(const Iterator begin, const Sentinel end, const Predicate& predicate,  // NOLINT(modernize-pass-by-value)
+                                              const Function& function)
+#endif
+    :
+            _iterator(begin),
+            _end(end),
+            _predicate(predicate),
+            _function(function)
+#ifdef LZ_HAS_EXECUTION
+            , _execution(execution)
+#endif
+            {
+        }
+
+        FilterMapIterator() = default;
+
+        LZ_CONSTEXPR_CXX_20 reference operator*() const {
+            return _function(*_iterator);
+        }
+
+        FakePointerProxy<reference> operator->() const {
+            return FakePointerProxy<decltype(**this)>(**this);
+        }
+
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator& operator++() {
+            if (!isAtEnd(_iterator, _end)) {
+                ++_iterator;
+                find();
+            }
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator operator++(int) {
+            FilterMapIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator& operator--() {
+            // The beginning always points to an element for which the predicate returns true, see FilterIterator
+            do {
+                --_iterator;
+            } while (!_predicate(*_iterator));
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_20 FilterMapIterator operator--(int) {
+            FilterMapIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_20 bool operator!=(const FilterMapIterator& other) const {
+            return _iterator != other._iterator;
+        }
+
+        LZ_CONSTEXPR_CXX_20 bool operator==(const FilterMapIterator& other) const {
+            return !(*this != other);
+        }
+
+        friend LZ_CONSTEXPR_CXX_20 SentinelType<Iterator> toSentinel(const FilterMapIterator& end) {
+            return toSentinel(end._iterator);
+        }
+
+        friend LZ_CONSTEXPR_CXX_20 bool isAtEnd(const FilterMapIterator& iterator, const SentinelType<Iterator>& end) {
+            return isAtEnd(iterator._iterator, end);
+        }
+
+        // The source is split instead of the filtered sequence, like FilterIterator does
+        friend IteratorRanges<FilterMapIterator>
+        splitRange(const FilterMapIterator& begin, const FilterMapIterator& end, const std::size_t parts) {
+            IteratorRanges<FilterMapIterator> ranges;
+            for (const std::pair<Iterator, Iterator>& range : splitRange(begin._iterator, end._iterator, parts)) {
+                const Sentinel sentinel = toSentinel(range.second);
+#ifdef LZ_HAS_EXECUTION
+                FilterMapIterator first(range.first, sentinel, begin._predicate, begin._function, begin._execution);
+                FilterMapIterator last(range.second, sentinel, begin._predicate, begin._function, begin._execution);
+#else
+                FilterMapIterator first(range.first, sentinel, begin._predicate, begin._function);
+                FilterMapIterator last(range.second, sentinel, begin._predicate, begin._function);
+#endif
+                first.find();
+                if (first != last) {
+                    ranges.emplace_back(std::move(first), std::move(last));
+                }
+            }
+            return ranges;
+        }
+    };
+}}
+
+#endif
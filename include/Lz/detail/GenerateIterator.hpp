@@ -20,16 +20,14 @@ namespace lz { namespace detail {
 
     private:
         std::size_t _current{};
-        GeneratorFunc _generator{};
-        bool _isWhileTrueLoop{};
+        LZ_NO_UNIQUE_ADDRESS GeneratorFunc _generator{};
 
     public:
         GenerateIterator() = default;
 
-        GenerateIterator(const std::size_t start, const GeneratorFunc& generatorFunc, const bool isWhileTrueLoop) :  // NOLINT(modernize-pass-by-value)
+        GenerateIterator(const std::size_t start, const GeneratorFunc& generatorFunc) :  // NOLINT(modernize-pass-by-value)
             _current(start),
-            _generator(generatorFunc),
-            _isWhileTrueLoop(isWhileTrueLoop)
+            _generator(generatorFunc)
         {}
 
         value_type operator*() const {
@@ -41,9 +39,7 @@ namespace lz { namespace detail {
         }
 
         GenerateIterator& operator++() {
-            if (!_isWhileTrueLoop) {
-                ++_current;
-            }
+            ++_current;
             return *this;
         }
 
@@ -54,9 +50,7 @@ namespace lz { namespace detail {
         }
 
         GenerateIterator& operator--() {
-            if (!_isWhileTrueLoop) {
-                --_current;
-            }
+            --_current;
             return *this;
         }
 
@@ -67,16 +61,12 @@ namespace lz { namespace detail {
         }
 
         GenerateIterator& operator+=(const difference_type offset) {
-            if (!_isWhileTrueLoop) {
-                _current += offset;
-            }
+            _current += offset;
             return *this;
         }
 
         GenerateIterator& operator-=(const difference_type offset) {
-            if (!_isWhileTrueLoop) {
-                _current -= offset;
-            }
+            _current -= offset;
             return *this;
         }
 
@@ -4,7 +4,11 @@
 #define LZ_LZ_TOOLS_HPP
 
 #define LZ_CURRENT_VERSION "2.0.0"
+#include <algorithm>
+#include <iterator>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #if defined(_MSVC_LANG) && (_MSVC_LANG >= 201103L) && (_MSVC_LANG < 201402L)
 #define LZ_HAS_CXX11
@@ -24,6 +28,34 @@
 #define LZ_HAS_CXX_20
 #endif // Has cxx 20
 
+#ifdef LZ_HAS_CXX17
+#define LZ_CONSTEXPR_CXX_17 constexpr
+#else
+#define LZ_CONSTEXPR_CXX_17
+#endif // has cxx 17
+
+#ifdef LZ_HAS_CXX_20
+#define LZ_CONSTEXPR_CXX_20 constexpr
+#else
+#define LZ_CONSTEXPR_CXX_20
+#endif // has cxx 20
+
+// Lets empty functions and execution policies take no space inside an iterator. The standard attribute is only used since
+// C++20, because compilers warn about it as an extension before that
+#if defined(_MSC_VER) && (_MSC_VER >= 1929)
+#define LZ_HAS_NO_UNIQUE_ADDRESS
+#define LZ_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif defined(LZ_HAS_CXX_20) && defined(__has_cpp_attribute) && !defined(_MSC_VER)
+#if __has_cpp_attribute(no_unique_address)
+#define LZ_HAS_NO_UNIQUE_ADDRESS
+#define LZ_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif // has no unique address
+#endif // has cpp attribute
+
+#ifndef LZ_HAS_NO_UNIQUE_ADDRESS
+#define LZ_NO_UNIQUE_ADDRESS
+#endif // no unique address is not supported
+
 #if __has_include(<execution>) && defined(LZ_HAS_CXX17)
 #define LZ_HAS_EXECUTION
 #include <execution>
@@ -115,6 +147,13 @@ namespace lz { namespace detail {
     template<class T>
     constexpr bool IsParallelPolicyV = IsParallelPolicy<T>::value;
 
+    // Used to tell execution policies apart from functions, in overloads that can take both
+    template<class T>
+    using EnableIfPolicy = std::enable_if_t<std::is_execution_policy_v<std::decay_t<T>>, int>;
+
+    template<class T>
+    using EnableIfNotPolicy = std::enable_if_t<!std::is_execution_policy_v<std::decay_t<T>>, int>;
+
     template<class Execution, class Iterator>
     constexpr void verifyIteratorAndPolicies(Execution, Iterator) {
         static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::*...");
@@ -187,6 +226,35 @@ namespace lz { namespace detail {
         }
     };
 
+    template<class T>
+    class FakePointerProxy<T&> {
+        T* _t;
+
+    public:
+        explicit FakePointerProxy(T& t) :
+            _t(&t) {
+        }
+
+        T* operator->() {
+            return _t;
+        }
+    };
+
+    // Copies of an input iterator share their position, so a post increment returns the old element by value
+    template<class T>
+    class PostIncrementProxy {
+        T _value;
+
+    public:
+        explicit PostIncrementProxy(T value) :
+            _value(std::move(value)) {
+        }
+
+        const T& operator*() const {
+            return _value;
+        }
+    };
+
     template<class Iterable>
     using IterType = Decay<decltype(std::begin(std::declval<Iterable>()))>;
 
@@ -199,6 +267,293 @@ namespace lz { namespace detail {
     template<class Function, class... Args>
     using FunctionReturnType = decltype(std::declval<Function>()(std::declval<Args>()...));
 
+    // A reference that a function returns for a temporary argument may point into that temporary, so it is only kept if
+    // the argument is an lvalue reference as well
+    template<class Result, class Argument>
+    using ReferenceIfLvalue = Conditional<std::is_lvalue_reference<Result>::value && std::is_lvalue_reference<Argument>::value,
+                                          Result, Decay<Result>>;
+
+    template<class Iterator>
+    struct IsRandomAccess : std::is_base_of<std::random_access_iterator_tag,
+                                            typename std::iterator_traits<Iterator>::iterator_category> {
+    };
+
+    template<class Iterator>
+    struct IsBidirectional : std::is_base_of<std::bidirectional_iterator_tag,
+                                             typename std::iterator_traits<Iterator>::iterator_category> {
+    };
+
+    // For views that skip elements: they can go backwards if their underlying iterator can, but they are never random access
+    template<class Iterator>
+    using BidirectionalOrForwardTag = Conditional<IsBidirectional<Iterator>::value,
+                                                  std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+
+    template<class... Iterators>
+    struct IsAllRandomAccess : std::true_type {
+    };
+
+    template<class First, class... Rest>
+    struct IsAllRandomAccess<First, Rest...> : std::integral_constant<bool,
+        IsRandomAccess<First>::value && IsAllRandomAccess<Rest...>::value> {
+    };
+
+    template<class Tag, class... Iterators>
+    struct IsAllOfCategory : std::true_type {
+    };
+
+    template<class Tag, class First, class... Rest>
+    struct IsAllOfCategory<Tag, First, Rest...> : std::integral_constant<bool,
+        std::is_base_of<Tag, typename std::iterator_traits<First>::iterator_category>::value &&
+        IsAllOfCategory<Tag, Rest...>::value> {
+    };
+
+    // The weakest category of the iterators, for iterators that move all of them at once
+    template<class... Iterators>
+    using WeakestIterCat = Conditional<IsAllRandomAccess<Iterators...>::value, std::random_access_iterator_tag,
+        Conditional<IsAllOfCategory<std::bidirectional_iterator_tag, Iterators...>::value, std::bidirectional_iterator_tag,
+        Conditional<IsAllOfCategory<std::forward_iterator_tag, Iterators...>::value, std::forward_iterator_tag,
+                    std::input_iterator_tag>>>;
+
+    template<class Container, class = void>
+    struct HasMutableData : std::false_type {
+    };
+
+    template<class Container>
+    struct HasMutableData<Container, decltype(void(std::declval<Container&>().resize(std::size_t())),
+                                              void(std::declval<Container&>().data()))>
+        : std::is_same<decltype(std::declval<Container&>().data()), typename Container::value_type*> {
+    };
+
+    template<class Container, class = void>
+    struct HasFillInsert : std::false_type {
+    };
+
+    template<class Container>
+    struct HasFillInsert<Container, decltype(void(std::declval<Container&>().insert(
+        std::declval<Container&>().end(), std::size_t(), std::declval<const typename Container::value_type&>())))>
+        : std::true_type {
+    };
+
+    // Views that know their elements up front use these to materialize themselves in bulk, instead of through the
+    // element by element copy of BasicIteratorView. They are called as `copyInto(container, begin, end)`.
+    template<class Container, class Generator>
+    EnableIf<HasMutableData<Container>::value && std::is_default_constructible<typename Container::value_type>::value, void>
+    appendGenerated(Container& container, const std::size_t size, Generator generator) {
+        const std::size_t offset = container.size();
+        container.resize(offset + size);
+        typename Container::value_type* data = container.data() + offset;
+        for (std::size_t i = 0; i < size; i++) {
+            data[i] = generator(i);
+        }
+    }
+
+    template<class Container, class Generator>
+    EnableIf<!(HasMutableData<Container>::value && std::is_default_constructible<typename Container::value_type>::value), void>
+    appendGenerated(Container& container, const std::size_t size, Generator generator) {
+        auto output = std::inserter(container, container.end());
+        for (std::size_t i = 0; i < size; i++, ++output) {
+            *output = generator(i);
+        }
+    }
+
+    template<class Container, class T>
+    EnableIf<HasFillInsert<Container>::value, void> appendFilled(Container& container, const std::size_t size, const T& value) {
+        container.insert(container.end(), size, value);
+    }
+
+    template<class Container, class T>
+    EnableIf<!HasFillInsert<Container>::value, void> appendFilled(Container& container, const std::size_t size, const T& value) {
+        appendGenerated(container, size, [&value](std::size_t) -> const T& { return value; });
+    }
+
+    // The projection that is used if no projection is given
+    struct Identity {
+        template<class T>
+        LZ_CONSTEXPR_CXX_17 T&& operator()(T&& value) const noexcept {
+            return std::forward<T>(value);
+        }
+    };
+
+    // Makes a pointer to a data member callable, e.g. `&Record::name` returns a reference to the name of a record
+    template<class Member>
+    class MemberProjection {
+        Member _member{};
+
+    public:
+        LZ_CONSTEXPR_CXX_17 MemberProjection(const Member member) :  // NOLINT(google-explicit-constructor)
+            _member(member) {
+        }
+
+        MemberProjection() = default;
+
+        template<class T>
+        LZ_CONSTEXPR_CXX_17 auto operator()(T&& object) const -> decltype(std::forward<T>(object).*std::declval<const Member&>()) {
+            return std::forward<T>(object).*_member;
+        }
+    };
+
+    template<class Function>
+    struct ProjectionFor {
+        using Type = Function;
+    };
+
+    template<class Member, class Class>
+    struct ProjectionFor<Member Class::*> {
+        using Type = MemberProjection<Member Class::*>;
+    };
+
+    // A projection is either a function with one parameter or a pointer to a data member
+    template<class Function>
+    using Projection = typename ProjectionFor<Function>::Type;
+
+    template<class Projection, class Iterator>
+    using ProjectedType = Decay<FunctionReturnType<const Projection&, typename std::iterator_traits<Iterator>::reference>>;
+
+    // Compares the projections of two values, so that e.g. records can be ordered by one of their members
+    template<class Compare, class Projection>
+    class ProjectedCompare {
+        LZ_NO_UNIQUE_ADDRESS Compare _compare;
+        LZ_NO_UNIQUE_ADDRESS Projection _projection;
+
+    public:
+        ProjectedCompare(const Compare& compare, const Projection& projection) :  // NOLINT(modernize-pass-by-value)
+            _compare(compare),
+            _projection(projection) {
+        }
+
+        ProjectedCompare() = default;
+
+        template<class A, class B>
+        bool operator()(A&& a, B&& b) const {
+            return _compare(_projection(std::forward<A>(a)), _projection(std::forward<B>(b)));
+        }
+    };
+
+    template<class Iterator>
+    using IteratorRanges = std::vector<std::pair<Iterator, Iterator>>;
+
+    // Input iterators can only be iterated once, so they cannot be split
+    template<class Iterator>
+    IteratorRanges<Iterator> splitRangeBy(const Iterator begin, const Iterator end, std::size_t /*parts*/, std::input_iterator_tag) {
+        IteratorRanges<Iterator> ranges;
+        if (begin != end) {
+            ranges.emplace_back(begin, end);
+        }
+        return ranges;
+    }
+
+    template<class Iterator>
+    IteratorRanges<Iterator> splitRangeBy(const Iterator begin, const Iterator end, std::size_t parts, std::forward_iterator_tag) {
+        using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+
+        const std::size_t size = static_cast<std::size_t>(std::distance(begin, end));
+        parts = std::min(std::max(parts, static_cast<std::size_t>(1)), size);
+        IteratorRanges<Iterator> ranges;
+        ranges.reserve(parts);
+        for (std::size_t i = 0; i < parts; i++) {
+            const Iterator partBegin = ranges.empty() ? begin : ranges.back().second;
+            const std::size_t partSize = size * (i + 1) / parts - size * i / parts;
+            ranges.emplace_back(partBegin, std::next(partBegin, static_cast<DifferenceType>(partSize)));
+        }
+        return ranges;
+    }
+
+    // Splits [begin, end) into at most `parts` non-empty, consecutive ranges of about the same size. Iterators that can
+    // be split more efficiently, or that must be split at specific positions, provide a `splitRange` friend
+    template<class Iterator>
+    IteratorRanges<Iterator> splitRange(const Iterator begin, const Iterator end, const std::size_t parts) {
+        return splitRangeBy(begin, end, parts, typename std::iterator_traits<Iterator>::iterator_category());
+    }
+
+    // The end of infinite views, such as `lz::generate(function)`. It compares unequal to every iterator, so adaptors over
+    // these views store no end and never check for it
+    struct UnreachableSentinel {};
+
+    // Adaptors that skip elements, such as filter, must know the end of their underlying sequence. Instead of a copy of
+    // the end iterator, they store its sentinel. That is the end iterator itself, unless the iterator provides a
+    // `toSentinel` and an `isAtEnd` friend, as the iterators of these adaptors do, so that a nested adaptor stores the
+    // end of the innermost sequence only
+    template<class Iterator>
+    constexpr Iterator toSentinel(const Iterator& end) {
+        return end;
+    }
+
+    template<class Iterator, class Sentinel>
+    constexpr bool isAtEnd(const Iterator& iterator, const Sentinel& end) {
+        return iterator == end;
+    }
+
+    template<class Iterator>
+    constexpr bool isAtEnd(const Iterator& /* iterator */, UnreachableSentinel /* end */) {
+        return false;
+    }
+
+    template<class Iterator>
+    using SentinelType = decltype(toSentinel(std::declval<const Iterator&>()));
+
+    // Calls `toSentinel` with argument dependent lookup, for callers outside of this namespace
+    template<class Iterator>
+    constexpr SentinelType<Iterator> sentinelFor(const Iterator& end) {
+        return toSentinel(end);
+    }
+
+    // Like std::find_if, but stops at a sentinel. Advances `iterator` in place, because iterators that hold a lambda are
+    // not assignable before C++20
+    template<class Iterator, class Sentinel, class Predicate>
+    LZ_CONSTEXPR_CXX_17 void advanceUntil(Iterator& iterator, const Sentinel& end, const Predicate& predicate) {
+        while (!isAtEnd(iterator, end) && !predicate(*iterator)) {
+            ++iterator;
+        }
+    }
+
+    // Like std::adjacent_find, but stops at a sentinel
+    template<class Iterator, class Sentinel, class BinaryPredicate>
+    LZ_CONSTEXPR_CXX_17 Iterator adjacentFind(Iterator iterator, const Sentinel& end, const BinaryPredicate& predicate) {
+        if (isAtEnd(iterator, end)) {
+            return iterator;
+        }
+        Iterator next = iterator;
+        while (!isAtEnd(++next, end)) {
+            if (predicate(*iterator, *next)) {
+                return iterator;
+            }
+            iterator = next;
+        }
+        return next;
+    }
+
+    // Specialized by infinite views, so that adaptors over them store an UnreachableSentinel as their end
+    template<class Iterable>
+    struct IsInfinite : std::false_type {};
+
+    template<class Iterable>
+    using SentinelOf = Conditional<IsInfinite<Decay<Iterable>>::value, UnreachableSentinel, SentinelType<IterType<Iterable>>>;
+
+    template<class Sentinel, class Iterable>
+    constexpr Sentinel endSentinel(Iterable& iterable, std::false_type /* is infinite */) {
+        return toSentinel(std::end(iterable));
+    }
+
+    template<class Sentinel, class Iterable>
+    constexpr Sentinel endSentinel(Iterable& /* iterable */, std::true_type /* is infinite */) {
+        return Sentinel();
+    }
+
+    template<class Iterable>
+    constexpr SentinelOf<Iterable> sentinelOf(Iterable&& iterable) {
+        return endSentinel<SentinelOf<Iterable>>(iterable, IsInfinite<Decay<Iterable>>());
+    }
+
+    // Specialized by ThreadPool.hpp for lz::Par, so that views can offer overloads that run on an executor without
+    // depending on the thread pool. A specialization provides `forEachChunk(executor, size, function)`
+    template<class Executor>
+    struct ExecutorTraits {
+        static constexpr bool isExecutor = false;
+    };
+
+    template<class Executor>
+    using IsExecutor = std::integral_constant<bool, ExecutorTraits<Executor>::isExecutor>;
+
     template<LZ_CONCEPT_INTEGRAL Arithmetic>
     inline bool isEven(const Arithmetic value) {
         return (value & 1) == 0;
@@ -11,33 +11,54 @@ namespace lz {
     class Map;
 
     namespace detail {
+        // Applies `Inner` and then `Outer`, so that two adjacent maps can be executed by a single iterator
+        template<class Outer, class Inner>
+        class ComposedFunction {
+            LZ_NO_UNIQUE_ADDRESS Inner _inner;
+            LZ_NO_UNIQUE_ADDRESS Outer _outer;
+
+        public:
+            LZ_CONSTEXPR_CXX_17 ComposedFunction(const Outer& outer, const Inner& inner) :  // NOLINT(modernize-pass-by-value)
+                _inner(inner),
+                _outer(outer) {
+            }
+
+            template<class T>
+            LZ_CONSTEXPR_CXX_17 auto operator()(T&& value) const
+                -> ReferenceIfLvalue<decltype(std::declval<const Outer&>()(std::declval<const Inner&>()(std::forward<T>(value)))),
+                                     decltype(std::declval<const Inner&>()(std::forward<T>(value)))> {
+                return _outer(_inner(std::forward<T>(value)));
+            }
+        };
 
         template<LZ_CONCEPT_ITERATOR Iterator, class Function>
         class MapIterator {
             Iterator _iterator{};
             using FnParamType = decltype(*_iterator);
             using FnReturnType = FunctionReturnType<Function, FnParamType>;
-            Function _function;
+            LZ_NO_UNIQUE_ADDRESS Function _function;
 
 
             friend class Map<Iterator, Function>;
 
 
         public:
-            using value_type = FnReturnType;
+            using value_type = Decay<FnReturnType>;
             using iterator_category = typename std::iterator_traits<Iterator>::iterator_category;
             using difference_type = std::ptrdiff_t;
-            using reference = value_type;
+            // Functions that return an lvalue reference, such as projections, yield a reference into the sequence. If the
+            // sequence yields temporaries, the reference would point into a destroyed temporary, so a copy is yielded
+            using reference = ReferenceIfLvalue<FnReturnType, typename std::iterator_traits<Iterator>::reference>;
             using pointer = FakePointerProxy<reference>;
 
-            MapIterator(const Iterator iterator, const Function& function) :  // NOLINT(modernize-pass-by-value)
+            LZ_CONSTEXPR_CXX_17 MapIterator(const Iterator iterator, const Function& function) :  // NOLINT(modernize-pass-by-value)
                 _iterator(iterator),
                 _function(function) {
             }
 
             MapIterator() = default;
 
-            value_type operator*() const {
+            LZ_CONSTEXPR_CXX_17 reference operator*() const {
                 return _function(*_iterator);
             }
 
@@ -45,81 +66,112 @@ namespace lz {
                 return FakePointerProxy<decltype(**this)>(**this);
             }
 
-            MapIterator& operator++() {
+            LZ_CONSTEXPR_CXX_17 MapIterator& operator++() {
                 ++_iterator;
                 return *this;
             }
 
-            MapIterator operator++(int) {
+            LZ_CONSTEXPR_CXX_17 MapIterator operator++(int) {
                 MapIterator tmp(*this);
                 ++*this;
                 return tmp;
             }
 
-            MapIterator& operator--() {
+            LZ_CONSTEXPR_CXX_17 MapIterator& operator--() {
                 --_iterator;
                 return *this;
             }
 
-            MapIterator operator--(int) {
+            LZ_CONSTEXPR_CXX_17 MapIterator operator--(int) {
                 MapIterator tmp(*this);
                 --*this;
                 return tmp;
             }
 
-            MapIterator& operator+=(const difference_type offset) {
+            LZ_CONSTEXPR_CXX_17 MapIterator& operator+=(const difference_type offset) {
                 _iterator += offset;
                 return *this;
             }
 
-            MapIterator& operator-=(const difference_type offset) {
+            LZ_CONSTEXPR_CXX_17 MapIterator& operator-=(const difference_type offset) {
                 _iterator -= offset;
                 return *this;
             }
 
-            MapIterator operator+(const difference_type offset) const {
+            LZ_CONSTEXPR_CXX_17 MapIterator operator+(const difference_type offset) const {
                 MapIterator tmp(*this);
                 tmp += offset;
                 return tmp;
             }
 
-            MapIterator operator-(const difference_type offset) const {
+            LZ_CONSTEXPR_CXX_17 MapIterator operator-(const difference_type offset) const {
                 MapIterator tmp(*this);
                 tmp -= offset;
                 return tmp;
             }
 
-            difference_type operator-(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 difference_type operator-(const MapIterator& other) const {
                 return _iterator - other._iterator;
             }
 
-            reference operator[](const difference_type offset) const {
+            LZ_CONSTEXPR_CXX_17 reference operator[](const difference_type offset) const {
                 return *(*this + offset);
             }
 
-            bool operator==(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 bool operator==(const MapIterator& other) const {
                 return !(*this != other);
             }
 
-            bool operator!=(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 bool operator!=(const MapIterator& other) const {
                 return _iterator != other._iterator;
             }
 
-            bool operator<(const MapIterator& other) const {
+            // Adaptors over a map store the sentinel of the mapped sequence as their end
+            friend LZ_CONSTEXPR_CXX_17 SentinelType<Iterator> toSentinel(const MapIterator& end) {
+                return toSentinel(end._iterator);
+            }
+
+            friend LZ_CONSTEXPR_CXX_17 bool isAtEnd(const MapIterator& iterator, const SentinelType<Iterator>& end) {
+                return isAtEnd(iterator._iterator, end);
+            }
+
+            LZ_CONSTEXPR_CXX_17 bool operator<(const MapIterator& other) const {
                 return _iterator < other._iterator;
             }
 
-            bool operator>(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 bool operator>(const MapIterator& other) const {
                 return other < *this;
             }
 
-            bool operator<=(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 bool operator<=(const MapIterator& other) const {
                 return !(other < *this);
             }
 
-            bool operator>=(const MapIterator& other) const {
+            LZ_CONSTEXPR_CXX_17 bool operator>=(const MapIterator& other) const {
                 return !(*this < other);
             }
+
+            // Maps over random access sequences are materialized by index, into storage that is sized up front
+            template<class Container, class I = Iterator>
+            friend EnableIf<IsRandomAccess<I>::value, void>
+            copyInto(Container& container, const MapIterator& begin, const MapIterator& end) {
+                using Difference = typename std::iterator_traits<Iterator>::difference_type;
+                const Iterator first = begin._iterator;
+                const Function& function = begin._function;
+
+                appendGenerated(container, static_cast<std::size_t>(end._iterator - first), [first, &function](const std::size_t i) {
+                    return function(first[static_cast<Difference>(i)]);
+                });
+            }
+
+            // The underlying sequence is split instead, so that e.g. a map over a filter is split by its source
+            friend IteratorRanges<MapIterator> splitRange(const MapIterator& begin, const MapIterator& end, const std::size_t parts) {
+                IteratorRanges<MapIterator> ranges;
+                for (const std::pair<Iterator, Iterator>& range : splitRange(begin._iterator, end._iterator, parts)) {
+                    ranges.emplace_back(MapIterator(range.first, begin._function), MapIterator(range.second, begin._function));
+                }
+                return ranges;
+            }
         };
     }
 }
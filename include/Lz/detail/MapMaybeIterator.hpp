@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef LZ_MAP_MAYBE_ITERATOR_HPP
+#define LZ_MAP_MAYBE_ITERATOR_HPP
+
+#include <iterator>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+    class MapMaybeIterator {
+        using IterTraits = std::iterator_traits<Iterator>;
+        // E.g. a std::optional or a pointer, anything that converts to bool and can be dereferenced
+        using Result = Decay<FunctionReturnType<Function, typename IterTraits::reference>>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using reference = decltype(*std::declval<const Result&>());
+        using value_type = Decay<reference>;
+        using difference_type = typename IterTraits::difference_type;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        Iterator _iterator{};
+        Iterator _end{};
+        LZ_NO_UNIQUE_ADDRESS Function _function;
+        // The result of the current element, so that the function is called once per element
+        Result _result{};
+
+        void findEngaged() {
+            for (; _iterator != _end; ++_iterator) {
+                _result = _function(*_iterator);
+                if (_result) {
+                    return;
+                }
+            }
+        }
+
+    public:
+        MapMaybeIterator(const Iterator iterator, const Iterator end, const Function& function) :  // NOLINT(modernize-pass-by-value)
+            _iterator(iterator),
+            _end(end),
+            _function(function) {
+            findEngaged();
+        }
+
+        MapMaybeIterator() = default;
+
+        reference operator*() const {
+            return *_result;
+        }
+
+        pointer operator->() const {
+            return FakePointerProxy<decltype(**this)>(**this);
+        }
+
+        MapMaybeIterator& operator++() {
+            ++_iterator;
+            findEngaged();
+            return *this;
+        }
+
+        MapMaybeIterator operator++(int) {
+            MapMaybeIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const MapMaybeIterator& other) const {
+            return _iterator == other._iterator;
+        }
+
+        bool operator!=(const MapMaybeIterator& other) const {
+            return !(*this == other);
+        }
+    };
+}}
+
+#endif
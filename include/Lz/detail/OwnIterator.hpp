@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef LZ_OWN_ITERATOR_HPP
+#define LZ_OWN_ITERATOR_HPP
+
+#include <iterator>
+#include <memory>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    // Every iterator shares the ownership of the container, so that views that are created from these iterators keep
+    // the container alive as well
+    template<class Container>
+    class OwnIterator {
+        using Iterator = IterType<Container&>;
+        using IterTraits = std::iterator_traits<Iterator>;
+
+        Iterator _iterator{};
+        std::shared_ptr<Container> _container{};
+
+    public:
+        using iterator_category = typename IterTraits::iterator_category;
+        using value_type = typename IterTraits::value_type;
+        using difference_type = typename IterTraits::difference_type;
+        using reference = typename IterTraits::reference;
+        using pointer = typename IterTraits::pointer;
+
+        OwnIterator(const Iterator iterator, std::shared_ptr<Container> container) :
+            _iterator(iterator),
+            _container(std::move(container)) {
+        }
+
+        OwnIterator() = default;
+
+        reference operator*() const {
+            return *_iterator;
+        }
+
+        pointer operator->() const {
+            return &*_iterator;
+        }
+
+        OwnIterator& operator++() {
+            ++_iterator;
+            return *this;
+        }
+
+        OwnIterator operator++(int) {
+            OwnIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        OwnIterator& operator--() {
+            --_iterator;
+            return *this;
+        }
+
+        OwnIterator operator--(int) {
+            OwnIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        OwnIterator& operator+=(const difference_type offset) {
+            _iterator += offset;
+            return *this;
+        }
+
+        OwnIterator& operator-=(const difference_type offset) {
+            _iterator -= offset;
+            return *this;
+        }
+
+        OwnIterator operator+(const difference_type offset) const {
+            OwnIterator tmp(*this);
+            tmp += offset;
+            return tmp;
+        }
+
+        OwnIterator operator-(const difference_type offset) const {
+            OwnIterator tmp(*this);
+            tmp -= offset;
+            return tmp;
+        }
+
+        difference_type operator-(const OwnIterator& other) const {
+            return _iterator - other._iterator;
+        }
+
+        reference operator[](const difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        bool operator==(const OwnIterator& other) const {
+            return _iterator == other._iterator;
+        }
+
+        bool operator!=(const OwnIterator& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const OwnIterator& other) const {
+            return _iterator < other._iterator;
+        }
+
+        bool operator>(const OwnIterator& other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const OwnIterator& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const OwnIterator& other) const {
+            return !(*this < other);
+        }
+    };
+}}
+
+#endif
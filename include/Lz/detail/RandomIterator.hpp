@@ -22,14 +22,12 @@ namespace lz { namespace detail {
     private:
         std::size_t _current{};
         Arithmetic _min{}, _max{};
-        bool _isWhileTrueLoop{};
 
     public:
-        explicit RandomIterator(const Arithmetic min, const Arithmetic max, const std::size_t current, const bool isWhileTrueLoop) :
+        explicit RandomIterator(const Arithmetic min, const Arithmetic max, const std::size_t current) :
             _current(current),
             _min(min),
-            _max(max),
-            _isWhileTrueLoop(isWhileTrueLoop) {
+            _max(max) {
         }
 
         RandomIterator() = default;
@@ -46,9 +44,7 @@ namespace lz { namespace detail {
         }
 
         RandomIterator& operator++() {
-            if (!_isWhileTrueLoop) {
-                ++_current;
-            }
+            ++_current;
             return *this;
         }
 
@@ -59,9 +55,7 @@ namespace lz { namespace detail {
         }
 
         RandomIterator& operator--() {
-            if (!_isWhileTrueLoop) {
-                --_current;
-            }
+            --_current;
             return *this;
         }
 
@@ -72,9 +66,7 @@ namespace lz { namespace detail {
         }
 
         RandomIterator& operator+=(const difference_type offset) {
-            if (!_isWhileTrueLoop) {
-                _current += offset;
-            }
+            _current += offset;
             return *this;
         }
 
@@ -85,9 +77,7 @@ namespace lz { namespace detail {
         }
 
         RandomIterator& operator-=(const difference_type offset) {
-            if (!_isWhileTrueLoop) {
-                _current -= offset;
-            }
+            _current -= offset;
             return *this;
         }
 
@@ -5,6 +5,8 @@
 
 #include <iterator>
 
+#include "LzTools.hpp"
+
 
 namespace lz { namespace detail {
     template<LZ_CONCEPT_ARITHMETIC Arithmetic>
@@ -12,6 +14,31 @@ namespace lz { namespace detail {
         Arithmetic _iterator{};
         Arithmetic _step{};
 
+        // The end of an integral range need not be a whole amount of steps away, the last partial step then counts as one
+        LZ_CONSTEXPR_CXX_17 Arithmetic stepsIn(const Arithmetic distance, std::true_type /* is integral */) const {
+            return static_cast<Arithmetic>(distance / _step +
+                                           (distance % _step == 0 ? 0 : (distance < 0) == (_step < 0) ? 1 : -1));
+        }
+
+        // The same holds for floating point ranges. std::trunc is not constexpr, so the quotient is truncated by a cast
+        LZ_CONSTEXPR_CXX_17 Arithmetic stepsIn(const Arithmetic distance, std::false_type /* is integral */) const {
+            const Arithmetic quotient = distance / _step;
+            const Arithmetic whole = static_cast<Arithmetic>(static_cast<long long>(quotient));
+            return whole == quotient ? whole : whole + (quotient < 0 ? -1 : 1);
+        }
+
+        // The amount of elements in [begin, end), where the last step may overshoot `end`
+        static std::size_t sizeOf(const RangeIterator& begin, const RangeIterator& end) {
+            const bool descending = begin._step < 0;
+            const Arithmetic distance = descending ? begin._iterator - end._iterator : end._iterator - begin._iterator;
+            const Arithmetic stride = descending ? static_cast<Arithmetic>(Arithmetic() - begin._step) : begin._step;
+
+            if (distance <= 0) {
+                return 0;
+            }
+            return static_cast<std::size_t>(distance / stride + (distance % stride != 0 ? 1 : 0));
+        }
+
     public:
         using iterator_category = std::random_access_iterator_tag;
         using value_type = Arithmetic;
@@ -19,14 +46,14 @@ namespace lz { namespace detail {
         using pointer = const Arithmetic*;
         using reference = Arithmetic;
 
-        RangeIterator(const Arithmetic iterator, const Arithmetic step) :
+        LZ_CONSTEXPR_CXX_17 RangeIterator(const Arithmetic iterator, const Arithmetic step) :
             _iterator(iterator),
             _step(step) {
         }
 
         RangeIterator() = default;
 
-        value_type operator*() const {
+        LZ_CONSTEXPR_CXX_17 value_type operator*() const {
             return _iterator;
         }
 
@@ -34,83 +61,116 @@ namespace lz { namespace detail {
             return &_iterator;
         }
 
-        RangeIterator& operator++() {
+        LZ_CONSTEXPR_CXX_17 RangeIterator& operator++() {
             _iterator += _step;
             return *this;
         }
 
-        RangeIterator operator++(int) {
+        LZ_CONSTEXPR_CXX_17 RangeIterator operator++(int) {
             RangeIterator tmp(*this);
             ++*this;
             return tmp;
         }
 
-        RangeIterator& operator--() {
+        LZ_CONSTEXPR_CXX_17 RangeIterator& operator--() {
             _iterator -= _step;
             return *this;
         }
 
-        RangeIterator operator--(int) {
+        LZ_CONSTEXPR_CXX_17 RangeIterator operator--(int) {
             RangeIterator tmp(*this);
             --*this;
             return tmp;
         }
 
-        RangeIterator& operator+=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_17 RangeIterator& operator+=(const difference_type offset) {
             _iterator += (offset * _step);
             return *this;
         }
 
-        RangeIterator operator+(const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_17 RangeIterator operator+(const difference_type offset) const {
             RangeIterator tmp(*this);
             return tmp += offset;
         }
 
-        RangeIterator& operator-=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_17 RangeIterator& operator-=(const difference_type offset) {
             _iterator -= (offset * _step);
             return *this;
         }
 
-        RangeIterator operator-(const difference_type other) const {
+        LZ_CONSTEXPR_CXX_17 RangeIterator operator-(const difference_type other) const {
             RangeIterator tmp = *this;
             return tmp -= other;
         }
 
-        difference_type operator-(const RangeIterator& other) const {
-            difference_type distance = _iterator - other._iterator;
-            return static_cast<difference_type>(distance / _step);
+        LZ_CONSTEXPR_CXX_17 difference_type operator-(const RangeIterator& other) const {
+            return stepsIn(_iterator - other._iterator, std::is_integral<Arithmetic>());
         }
 
-        value_type operator[](const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_17 value_type operator[](const difference_type offset) const {
             return *(*this + offset);
         }
 
-        bool operator!=(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator!=(const RangeIterator& other) const {
             if (_step < 0) {
                 return _iterator > other._iterator;
             }
             return _iterator < other._iterator;
         }
 
-        bool operator==(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator==(const RangeIterator& other) const {
             return !(*this != other);
         }
 
-        bool operator<(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator<(const RangeIterator& other) const {
             return _iterator < other._iterator;
         }
 
-        bool operator>(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator>(const RangeIterator& other) const {
             return other < *this;
         }
 
-        bool operator<=(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator<=(const RangeIterator& other) const {
             return !(other < *this);
         }
 
-        bool operator>=(const RangeIterator& other) const {
+        LZ_CONSTEXPR_CXX_17 bool operator>=(const RangeIterator& other) const {
             return !(*this < other);
         }
+
+        // Integral ranges are materialized using start + i * step, which can be vectorized. This is not done for
+        // floating point ranges, because they would yield slightly different values than adding the step repeatedly
+        template<class Container, class A = Arithmetic>
+        friend EnableIf<std::is_integral<A>::value, void>
+        copyInto(Container& container, const RangeIterator& begin, const RangeIterator& end) {
+            const Arithmetic start = begin._iterator;
+            const Arithmetic step = begin._step;
+            appendGenerated(container, sizeOf(begin, end), [start, step](const std::size_t i) {
+                return static_cast<Arithmetic>(start + static_cast<Arithmetic>(i) * step);
+            });
+        }
+
+        // Integral ranges are arithmetic sequences, so the sum is size * (first + last) / 2
+        template<class A = Arithmetic>
+        friend EnableIf<std::is_integral<A>::value, Arithmetic> sumOf(const RangeIterator& begin, const RangeIterator& end) {
+            const auto size = static_cast<Arithmetic>(sizeOf(begin, end));
+            if (size == 0) {
+                return Arithmetic();
+            }
+            const Arithmetic first = begin._iterator;
+            const Arithmetic last = static_cast<Arithmetic>(first + (size - 1) * begin._step);
+            // Either size or first + last is even, divide that one to stay exact
+            return size % 2 == 0 ? static_cast<Arithmetic>(size / 2 * (first + last)) :
+                   static_cast<Arithmetic>(size * ((first + last) / 2));
+        }
+
+        template<class A = Arithmetic>
+        friend EnableIf<std::is_integral<A>::value, std::pair<Arithmetic, Arithmetic>>
+        minMaxOf(const RangeIterator& begin, const RangeIterator& end) {
+            const Arithmetic first = begin._iterator;
+            const Arithmetic last = static_cast<Arithmetic>(first + static_cast<Arithmetic>(sizeOf(begin, end) - 1) * begin._step);
+            return first < last ? std::make_pair(first, last) : std::make_pair(last, first);
+        }
     };
 }}
 
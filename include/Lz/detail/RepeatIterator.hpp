@@ -5,16 +5,16 @@
 
 #include <iterator>
 
+#include "LzTools.hpp"
+
 
 namespace lz { namespace detail {
     template<class T>
     struct RepeatIteratorHelper {
         mutable T toRepeat{};
-        bool isWhileTrueLoop{};
 
-        RepeatIteratorHelper(T toRepeat, bool isWhileTrueLoop) :
-            toRepeat(std::move(toRepeat)),
-            isWhileTrueLoop(isWhileTrueLoop)
+        explicit RepeatIteratorHelper(T toRepeat) :
+            toRepeat(std::move(toRepeat))
         {}
 
         RepeatIteratorHelper() = default;
@@ -48,9 +48,7 @@ namespace lz { namespace detail {
         }
 
         RepeatIterator& operator++() {
-            if (!_iterHelper->isWhileTrueLoop) {
-                ++_iterator;
-            }
+            ++_iterator;
             return *this;
         }
 
@@ -61,9 +59,7 @@ namespace lz { namespace detail {
         }
 
         RepeatIterator& operator--() {
-            if (!_iterHelper->isWhileTrueLoop) {
-                --_iterator;
-            }
+            --_iterator;
             return *this;
         }
 
@@ -74,16 +70,12 @@ namespace lz { namespace detail {
         }
 
         RepeatIterator& operator+=(const difference_type offset) {
-            if (!_iterHelper->isWhileTrueLoop) {
-                _iterator += offset;
-            }
+            _iterator += offset;
             return *this;
         }
 
         RepeatIterator& operator-=(const difference_type offset) {
-            if (!_iterHelper->isWhileTrueLoop) {
-                _iterator -= offset;
-            }
+            _iterator -= offset;
             return *this;
         }
 
@@ -130,6 +122,21 @@ namespace lz { namespace detail {
         bool operator>=(const RepeatIterator& other) const {
             return !(*this < other);
         }
+
+        // Repeating a value is materialized as a fill, e.g. `std::vector<T>(amount, value)`
+        template<class Container>
+        friend void copyInto(Container& container, const RepeatIterator& begin, const RepeatIterator& end) {
+            appendFilled(container, end._iterator - begin._iterator, begin._iterHelper->toRepeat);
+        }
+
+        template<class U = T>
+        friend EnableIf<std::is_arithmetic<U>::value, T> sumOf(const RepeatIterator& begin, const RepeatIterator& end) {
+            return static_cast<T>(begin._iterHelper->toRepeat * static_cast<T>(end._iterator - begin._iterator));
+        }
+
+        friend std::pair<T, T> minMaxOf(const RepeatIterator& begin, const RepeatIterator&) {
+            return {begin._iterHelper->toRepeat, begin._iterHelper->toRepeat};
+        }
     };
 }}
 
@@ -0,0 +1,211 @@
+#pragma once
+
+#ifndef LZ_RING_BUFFER_HPP
+#define LZ_RING_BUFFER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    constexpr std::size_t CacheLineSize = 64;
+
+    // Waits a little longer on every attempt, so that a thread that waits for a slow thread does not keep a core busy
+    inline void backOff(const std::size_t attempt) {
+        if (attempt < 64) {
+            std::this_thread::yield();
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::microseconds(attempt < 1024 ? 10 : 100));
+        }
+    }
+
+    // A bounded queue for exactly one producer thread and one consumer thread, that does not lock. Both positions only
+    // increase, the slot of a position is `position % capacity`. Every side keeps a copy of the position of the other
+    // side, so that the shared positions are only read when the queue seems to be full or empty
+    template<class T>
+    class SpscRingBuffer {
+        using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        std::vector<Slot> _slots;
+        // Both sides are placed on their own cache line, so that they do not slow each other down
+        char _padding0[CacheLineSize]{};
+        std::atomic<std::size_t> _head{0};
+        std::size_t _cachedTail = 0;
+        char _padding1[CacheLineSize]{};
+        std::atomic<std::size_t> _tail{0};
+        std::size_t _cachedHead = 0;
+        char _padding2[CacheLineSize]{};
+
+        T* slot(const std::size_t position) {
+            return reinterpret_cast<T*>(&_slots[position % _slots.size()]);
+        }
+
+    public:
+        explicit SpscRingBuffer(const std::size_t capacity) :
+            _slots(capacity == 0 ? 1 : capacity) {
+        }
+
+        SpscRingBuffer(const SpscRingBuffer&) = delete;
+
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+        ~SpscRingBuffer() {
+            for (std::size_t position = _head.load(); position != _tail.load(); position++) {
+                slot(position)->~T();
+            }
+        }
+
+        // Producer only. `value` is only moved from if there is room
+        bool tryPush(T& value) {
+            const std::size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _cachedHead == _slots.size()) {
+                _cachedHead = _head.load(std::memory_order_acquire);
+                if (tail - _cachedHead == _slots.size()) {
+                    return false;
+                }
+            }
+            ::new(static_cast<void*>(slot(tail))) T(std::move(value));
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only. Returns nullptr if the queue is empty
+        T* front() {
+            const std::size_t head = _head.load(std::memory_order_relaxed);
+            if (head == _cachedTail) {
+                _cachedTail = _tail.load(std::memory_order_acquire);
+                if (head == _cachedTail) {
+                    return nullptr;
+                }
+            }
+            return slot(head);
+        }
+
+        // Consumer only. The queue must not be empty
+        void pop() {
+            const std::size_t head = _head.load(std::memory_order_relaxed);
+            slot(head)->~T();
+            _head.store(head + 1, std::memory_order_release);
+        }
+    };
+
+    // A bounded queue for any amount of producer and consumer threads, that does not lock. Every slot has a sequence
+    // number: a producer may write position `p` if the sequence of its slot is `p`, and a consumer may read it if the
+    // sequence is `p + 1`. A thread claims a run of ready positions with a single compare exchange, so that batches do
+    // not cost an atomic operation per element
+    template<class T>
+    class MpmcRingBuffer {
+        using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            Slot value;
+        };
+
+        std::unique_ptr<Cell[]> _cells;
+        std::size_t _capacity;
+        char _padding0[CacheLineSize]{};
+        std::atomic<std::size_t> _tail{0};
+        char _padding1[CacheLineSize]{};
+        std::atomic<std::size_t> _head{0};
+        char _padding2[CacheLineSize]{};
+
+        Cell& cell(const std::size_t position) {
+            return _cells[position % _capacity];
+        }
+
+        static T* valueOf(Cell& cell) {
+            return reinterpret_cast<T*>(&cell.value);
+        }
+
+        // Claims at most `count` positions of `next`, of which the slots have the sequence `position + lag`. Returns
+        // the amount of claimed positions, the first one is written to `first`
+        std::size_t claim(std::atomic<std::size_t>& next, const std::size_t lag, const std::size_t count,
+                          std::size_t& first) {
+            std::size_t position = next.load(std::memory_order_relaxed);
+            while (true) {
+                std::size_t ready = 0;
+                while (ready != count && ready != _capacity &&
+                       cell(position + ready).sequence.load(std::memory_order_acquire) == position + ready + lag) {
+                    ready++;
+                }
+                if (ready == 0) {
+                    // If no other thread claimed `position` in the meantime, the queue is full or empty
+                    const std::size_t current = next.load(std::memory_order_relaxed);
+                    if (current == position) {
+                        return 0;
+                    }
+                    position = current;
+                }
+                // The slots can only change after `next` is moved past them, so they are still ready if this succeeds
+                else if (next.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                    first = position;
+                    return ready;
+                }
+            }
+        }
+
+    public:
+        // With a single slot, a written slot would have the sequence of the next free position
+        explicit MpmcRingBuffer(const std::size_t capacity) :
+            _cells(new Cell[capacity < 2 ? 2 : capacity]),
+            _capacity(capacity < 2 ? 2 : capacity) {
+            for (std::size_t i = 0; i != _capacity; i++) {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+
+        MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+        ~MpmcRingBuffer() {
+            for (std::size_t position = _head.load(); position != _tail.load(); position++) {
+                valueOf(cell(position))->~T();
+            }
+        }
+
+        std::size_t capacity() const {
+            return _capacity;
+        }
+
+        // Moves at most `count` elements from `first` into the queue, and returns the amount of moved elements. Moving
+        // must not throw, as the claimed slots would never be written otherwise
+        std::size_t tryPush(T* first, const std::size_t count) {
+            std::size_t position = 0;
+            const std::size_t claimed = claim(_tail, 0, count, position);
+            for (std::size_t i = 0; i != claimed; i++) {
+                Cell& claimedCell = cell(position + i);
+                ::new(static_cast<void*>(&claimedCell.value)) T(std::move(first[i]));
+                claimedCell.sequence.store(position + i + 1, std::memory_order_release);
+            }
+            return claimed;
+        }
+
+        // Passes at most `count` elements to `consume`, which may move from them but must not throw, and returns the
+        // amount of passed elements
+        template<class Function>
+        std::size_t tryPop(Function consume, const std::size_t count) {
+            std::size_t position = 0;
+            const std::size_t claimed = claim(_head, 1, count, position);
+            for (std::size_t i = 0; i != claimed; i++) {
+                Cell& claimedCell = cell(position + i);
+                T* value = valueOf(claimedCell);
+                consume(*value);
+                value->~T();
+                claimedCell.sequence.store(position + i + _capacity, std::memory_order_release);
+            }
+            return claimed;
+        }
+    };
+}}
+
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef LZ_SELECTION_ITERATOR_HPP
+#define LZ_SELECTION_ITERATOR_HPP
+
+#include <iterator>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    class SelectionIterator {
+        using IterTraits = std::iterator_traits<Iterator>;
+
+        const Iterator* _selected{};
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename IterTraits::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename IterTraits::reference;
+        using pointer = typename IterTraits::pointer;
+
+        explicit SelectionIterator(const Iterator* selected) :
+            _selected(selected) {
+        }
+
+        SelectionIterator() = default;
+
+        reference operator*() const {
+            return **_selected;
+        }
+
+        pointer operator->() const {
+            return &**_selected;
+        }
+
+        SelectionIterator& operator++() {
+            ++_selected;
+            return *this;
+        }
+
+        SelectionIterator operator++(int) {
+            SelectionIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        SelectionIterator& operator--() {
+            --_selected;
+            return *this;
+        }
+
+        SelectionIterator operator--(int) {
+            SelectionIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        SelectionIterator& operator+=(const difference_type offset) {
+            _selected += offset;
+            return *this;
+        }
+
+        SelectionIterator& operator-=(const difference_type offset) {
+            _selected -= offset;
+            return *this;
+        }
+
+        SelectionIterator operator+(const difference_type offset) const {
+            SelectionIterator tmp(*this);
+            tmp += offset;
+            return tmp;
+        }
+
+        SelectionIterator operator-(const difference_type offset) const {
+            SelectionIterator tmp(*this);
+            tmp -= offset;
+            return tmp;
+        }
+
+        difference_type operator-(const SelectionIterator& other) const {
+            return _selected - other._selected;
+        }
+
+        reference operator[](const difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        bool operator==(const SelectionIterator& other) const {
+            return _selected == other._selected;
+        }
+
+        bool operator!=(const SelectionIterator& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const SelectionIterator& other) const {
+            return _selected < other._selected;
+        }
+
+        bool operator>(const SelectionIterator& other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const SelectionIterator& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const SelectionIterator& other) const {
+            return !(*this < other);
+        }
+    };
+}}
+
+#endif
@@ -19,12 +19,15 @@ namespace lz {
     namespace detail {
         template<class String>
         struct SplitViewIteratorHelper {
+            // Strings that are passed as an rvalue are moved into the splitter, so that they cannot dangle
+            using Storage = Conditional<std::is_lvalue_reference<String>::value, const Decay<String>&, Decay<String>>;
+
             std::string delimiter{};
-            const String& string = String();
+            Storage string = Decay<String>();
 
-            SplitViewIteratorHelper(std::string delimiter, const String& string) :
+            SplitViewIteratorHelper(std::string delimiter, String&& string) :
                 delimiter(std::move(delimiter)),
-                string(string)
+                string(std::forward<String>(string))
             {}
 
             SplitViewIteratorHelper() = default;
@@ -107,6 +110,40 @@ namespace lz {
                 ++* this;
                 return tmp;
             }
+
+            // Every part starts right after a delimiter, so that the parts yield the same substrings as the whole
+            // sequence. A delimiter that can overlap itself, such as "aa", may be found at other positions when
+            // searching from the middle of the string, so such strings are not split
+            friend IteratorRanges<SplitIterator> splitRange(const SplitIterator& begin, const SplitIterator& end, const std::size_t parts) {
+                const SplitViewIteratorHelper<String>* helper = begin._splitIteratorHelper;
+                const std::string& delimiter = helper->delimiter;
+                const std::size_t delimLen = delimiter.length();
+
+                IteratorRanges<SplitIterator> ranges;
+                if (begin == end) {
+                    return ranges;
+                }
+                bool overlaps = delimLen == 0;
+                for (std::size_t i = 1; i < delimLen && !overlaps; i++) {
+                    overlaps = delimiter.compare(i, delimLen - i, delimiter, 0, delimLen - i) == 0;
+                }
+
+                std::size_t partBegin = begin._currentPos;
+                const std::size_t last = end._currentPos;
+                for (std::size_t i = 1; i < parts && !overlaps; i++) {
+                    const std::size_t offset = begin._currentPos + (last - begin._currentPos) * i / parts;
+                    const std::size_t found = helper->string.find(delimiter, std::max(offset, partBegin));
+                    if (found == std::string::npos || found + delimLen >= last) {
+                        break;
+                    }
+                    SplitIterator partEnd(found + delimLen, helper);
+                    partEnd._last = helper->string.find(delimiter, partEnd._currentPos);
+                    ranges.emplace_back(ranges.empty() ? begin : ranges.back().second, partEnd);
+                    partBegin = partEnd._currentPos;
+                }
+                ranges.emplace_back(ranges.empty() ? begin : ranges.back().second, end);
+                return ranges;
+            }
         };
     }
 }
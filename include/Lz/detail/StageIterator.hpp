@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef LZ_STAGE_ITERATOR_HPP
+#define LZ_STAGE_ITERATOR_HPP
+
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+#include "LzTools.hpp"
+#include "RingBuffer.hpp"
+
+
+namespace lz { namespace detail {
+    template<class Iterator>
+    class StageState {
+    public:
+        using ValueType = typename std::iterator_traits<Iterator>::value_type;
+
+    private:
+        Iterator _begin;
+        Iterator _end;
+        SpscRingBuffer<ValueType> _buffer;
+        std::atomic<bool> _finished{false};
+        std::atomic<bool> _cancelled{false};
+        // Only written by the producer before `_finished` is set
+        std::exception_ptr _exception{};
+        std::thread _producer{};
+
+        void produce() {
+            try {
+                // Checked before every element as well, so that a cancelled stage does not keep reading a slow upstream
+                // sequence until the buffer is full
+                for (Iterator it = _begin; !_cancelled.load(std::memory_order_relaxed) && it != _end; ++it) {
+                    ValueType value(*it);
+                    for (std::size_t attempt = 0; !_buffer.tryPush(value); attempt++) {
+                        if (_cancelled.load(std::memory_order_relaxed)) {
+                            return;
+                        }
+                        backOff(attempt);
+                    }
+                }
+            }
+            catch (...) {
+                _exception = std::current_exception();
+            }
+            _finished.store(true, std::memory_order_release);
+        }
+
+        // Returns nullptr if the upstream sequence is done, or rethrows its exception
+        ValueType* waitForFront() {
+            // The thread is started when the view is read, so that views that are never read do not cost a thread
+            if (!_producer.joinable()) {
+                _producer = std::thread(&StageState::produce, this);
+            }
+            for (std::size_t attempt = 0;; attempt++) {
+                if (ValueType* front = _buffer.front()) {
+                    return front;
+                }
+                if (_finished.load(std::memory_order_acquire)) {
+                    // The elements that were pushed before the producer finished are visible now
+                    if (ValueType* front = _buffer.front()) {
+                        return front;
+                    }
+                    if (_exception) {
+                        std::exception_ptr exception = _exception;
+                        _exception = nullptr;
+                        std::rethrow_exception(exception);
+                    }
+                    return nullptr;
+                }
+                backOff(attempt);
+            }
+        }
+
+    public:
+        StageState(const Iterator begin, const Iterator end, const std::size_t capacity) :
+            _begin(begin),
+            _end(end),
+            _buffer(capacity) {
+        }
+
+        StageState(const StageState&) = delete;
+
+        StageState& operator=(const StageState&) = delete;
+
+        // The producer may be waiting for room, e.g. if the view is not read until its end
+        ~StageState() {
+            _cancelled.store(true, std::memory_order_relaxed);
+            if (_producer.joinable()) {
+                _producer.join();
+            }
+        }
+
+        ValueType& current() {
+            return *waitForFront();
+        }
+
+        void next() {
+            waitForFront();
+            _buffer.pop();
+        }
+
+        bool done() {
+            return waitForFront() == nullptr;
+        }
+    };
+
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    class StageIterator {
+        using State = StageState<Iterator>;
+
+        std::shared_ptr<State> _state{};
+
+        bool isEnd() const {
+            return _state == nullptr || _state->done();
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename State::ValueType;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using pointer = value_type*;
+
+        explicit StageIterator(std::shared_ptr<State> state) :
+            _state(std::move(state)) {
+        }
+
+        StageIterator() = default;
+
+        reference operator*() const {
+            return _state->current();
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        StageIterator& operator++() {
+            _state->next();
+            return *this;
+        }
+
+        PostIncrementProxy<value_type> operator++(int) {
+            PostIncrementProxy<value_type> old(**this);
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const StageIterator& other) const {
+            return isEnd() == other.isEnd();
+        }
+
+        bool operator!=(const StageIterator& other) const {
+            return !(*this == other);
+        }
+    };
+}}
+
+#endif
@@ -16,11 +16,16 @@ namespace lz {
     template<LZ_CONCEPT_ITERATOR Iterator>
     class TakeEveryIterator {
         Iterator _iterator{};
-        Iterator _end{};
         std::size_t _offset{};
+        // The position of `_iterator` and the size of the underlying sequence, so that no end needs to be stored
         std::size_t _current{};
         std::size_t _distance{};
 
+        void toEnd() {
+            _iterator = std::next(_iterator, static_cast<difference_type>(_distance - _current));
+            _current = _distance;
+        }
+
 
         friend class TakeEvery<Iterator>;
         using IterTraits = std::iterator_traits<Iterator>;
@@ -32,11 +37,10 @@ namespace lz {
         using reference = typename IterTraits::reference;
         using pointer = typename IterTraits::pointer;
 
-        TakeEveryIterator(const Iterator iterator, const Iterator end, const std::size_t offset, const std::size_t distance) :
+        TakeEveryIterator(const Iterator iterator, const std::size_t offset, const std::size_t current, const std::size_t distance) :
             _iterator(iterator),
-            _end(end),
             _offset(offset),
-            _current(iterator == end ? distance : 0),
+            _current(current),
             _distance(distance) {
         }
 
@@ -76,7 +80,7 @@ namespace lz {
             auto total = static_cast<std::size_t>(_offset * offset);
 
             if (_current + total >= _distance) {
-                _iterator = _end;
+                toEnd();
             }
             else {
                 _iterator = std::next(_iterator, total);
@@ -89,7 +93,7 @@ namespace lz {
             auto total = _offset * offset;
 
             if (static_cast<std::ptrdiff_t>(_current - total) < 0) {
-                _iterator = _end;
+                toEnd();
             }
             else {
                 _iterator = std::prev(_iterator, total);
@@ -143,6 +147,14 @@ namespace lz {
         bool operator>=(const TakeEveryIterator& other) const {
             return !(*this < other);
         }
+
+        friend SentinelType<Iterator> toSentinel(const TakeEveryIterator& end) {
+            return toSentinel(end._iterator);
+        }
+
+        friend bool isAtEnd(const TakeEveryIterator& iterator, const SentinelType<Iterator>& end) {
+            return isAtEnd(iterator._iterator, end);
+        }
     };
 }}
 
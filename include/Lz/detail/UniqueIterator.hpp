@@ -12,68 +12,77 @@
 
 namespace lz { namespace detail {
 #ifdef LZ_HAS_EXECUTION
-    template<class Execution, LZ_CONCEPT_ITERATOR Iterator>
+    template<class Execution, LZ_CONCEPT_ITERATOR Iterator, class Projection = Identity>
 #else
-    template<LZ_CONCEPT_ITERATOR Iterator>
+    template<LZ_CONCEPT_ITERATOR Iterator, class Projection = Identity>
 #endif
     class UniqueIterator {
         using IterTraits = std::iterator_traits<Iterator>;
+        // Elements are equal if their projections are equal
+        using Compare = ProjectedCompare<std::less<ProjectedType<Projection, Iterator>>, Projection>;
 
         Iterator _iterator{};
-        Iterator _end{};
+        // Only used to go backwards, to find the start of the previous group of equal elements
+        Iterator _begin{};
+        LZ_NO_UNIQUE_ADDRESS SentinelType<Iterator> _end{};
+        LZ_NO_UNIQUE_ADDRESS Compare _compare{};
 #ifdef LZ_HAS_EXECUTION
-        Execution _execution;
+        LZ_NO_UNIQUE_ADDRESS Execution _execution;
 #endif
 
     public:
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = BidirectionalOrForwardTag<Iterator>;
         using value_type = typename IterTraits::value_type;
         using difference_type = typename IterTraits::difference_type;
         using pointer = typename IterTraits::pointer;
         using reference = typename IterTraits::reference;
 
 #ifdef LZ_HAS_EXECUTION
-        UniqueIterator(const Iterator begin, const Iterator end, const Execution execution)
+        UniqueIterator(const Iterator iterator, const Iterator begin, const Iterator end, const Projection& projection,
+                       const Execution execution)
 #else
-        UniqueIterator(const Iterator begin, const Iterator end)
+        UniqueIterator(const Iterator iterator, const Iterator begin, const Iterator end, const Projection& projection)
 #endif
         :
-            _iterator(begin),
-            _end(end)
+            _iterator(iterator),
+            _begin(begin),
+            _end(toSentinel(end)),
+            _compare(std::less<ProjectedType<Projection, Iterator>>(), projection)
 #ifdef LZ_HAS_EXECUTION
             , _execution(execution)
 #endif
         {
-            if (begin == end) {
+            // Only the beginning of the view sorts the sequence
+            if (iterator != begin || begin == end) {
                 return;
             }
 
 #ifdef LZ_HAS_EXECUTION
             if constexpr (IsSequencedPolicyV<Execution>) {
-                if (std::is_sorted(begin, end)) {
+                if (std::is_sorted(begin, end, _compare)) {
                     return;
                 }
             }
             else {
-                if (std::is_sorted(_execution, begin, end)) {
+                if (std::is_sorted(_execution, begin, end, _compare)) {
                     return;
                 }
             }
 #else
-            if (std::is_sorted(begin, end)) {
+            if (std::is_sorted(begin, end, _compare)) {
                 return;
             }
 #endif
 
 #ifdef LZ_HAS_EXECUTION
             if constexpr (IsSequencedPolicyV<Execution>) {
-                std::sort(begin, end);
+                std::sort(begin, end, _compare);
             }
             else {
-                std::sort(_execution, begin, end);
+                std::sort(_execution, begin, end, _compare);
             }
 #else
-            std::sort(begin, end);
+            std::sort(begin, end, _compare);
 #endif
         }
 
@@ -89,17 +98,17 @@ namespace lz { namespace detail {
 
         UniqueIterator& operator++() {
 #ifdef LZ_HAS_EXECUTION
-            if constexpr (IsSequencedPolicyV<Execution>) {
-                _iterator = std::adjacent_find(_iterator, _end, std::less<value_type>());
+            if constexpr (!IsSequencedPolicyV<Execution> && std::is_same_v<SentinelType<Iterator>, Iterator>) {
+                _iterator = std::adjacent_find(_execution, _iterator, _end, _compare);
             }
             else {
-                _iterator = std::adjacent_find(_execution, _iterator, _end, std::less<value_type>());
+                _iterator = adjacentFind(_iterator, _end, _compare);
             }
 #else
-            _iterator = std::adjacent_find(_iterator, _end, std::less<value_type>());
+            _iterator = adjacentFind(_iterator, _end, _compare);
 #endif
 
-            if (_iterator != _end) {
+            if (!isAtEnd(_iterator, _end)) {
                 ++_iterator;
             }
             return *this;
@@ -111,6 +120,21 @@ namespace lz { namespace detail {
             return tmp;
         }
 
+        UniqueIterator& operator--() {
+            --_iterator;
+            // The sequence is sorted, so walk back to the first element of this group of equal elements
+            while (_iterator != _begin && !_compare(*std::prev(_iterator), *_iterator)) {
+                --_iterator;
+            }
+            return *this;
+        }
+
+        UniqueIterator operator--(int) {
+            UniqueIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
         bool operator!=(const UniqueIterator& other) const {
             return _iterator != other._iterator;
         }
@@ -118,6 +142,14 @@ namespace lz { namespace detail {
         bool operator==(const UniqueIterator& other) const {
             return !(*this != other);
         }
+
+        friend SentinelType<Iterator> toSentinel(const UniqueIterator& end) {
+            return toSentinel(end._iterator);
+        }
+
+        friend bool isAtEnd(const UniqueIterator& iterator, const SentinelType<Iterator>& end) {
+            return isAtEnd(iterator._iterator, end);
+        }
     };
 }}
 
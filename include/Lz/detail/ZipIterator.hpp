@@ -12,7 +12,8 @@ namespace lz { namespace detail {
     template<LZ_CONCEPT_ITERATOR... Iterators>
     class ZipIterator {
     public:
-        using iterator_category = std::random_access_iterator_tag;
+        // A list in the zip makes the zip as slow to index as the list
+        using iterator_category = WeakestIterCat<Iterators...>;
         using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
         using difference_type = std::ptrdiff_t;
         using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
@@ -23,45 +24,45 @@ namespace lz { namespace detail {
         std::tuple<Iterators...> _iterators{};
 
         template<std::size_t... I>
-        reference dereference(IndexSequence<I...>) const {
+        LZ_CONSTEXPR_CXX_20 reference dereference(IndexSequence<I...>) const {
             return reference{*std::get<I>(_iterators)...};
         }
 
         template<std::size_t... I>
-        void increment(IndexSequence<I...>) {
+        LZ_CONSTEXPR_CXX_20 void increment(IndexSequence<I...>) {
             const std::initializer_list<int> expand = {(++std::get<I>(_iterators), 0)...};
             static_cast<void>(expand);
         }
 
         template<std::size_t... I>
-        void decrement(IndexSequence<I...>) {
+        LZ_CONSTEXPR_CXX_20 void decrement(IndexSequence<I...>) {
             const std::initializer_list<int> expand = {(--std::get<I>(_iterators), 0)...};
             static_cast<void>(expand);
         }
 
         template<std::size_t... I>
-        void plusIs(IndexSequence<I...>, const difference_type differenceType) {
+        LZ_CONSTEXPR_CXX_20 void plusIs(IndexSequence<I...>, const difference_type differenceType) {
             const std::initializer_list<int> expand = {
                 (std::get<I>(_iterators) = std::next(std::get<I>(_iterators), differenceType), 0)...};
             static_cast<void>(expand);
         }
 
         template<std::size_t... I>
-        void minIs(IndexSequence<I...>, const difference_type differenceType) {
+        LZ_CONSTEXPR_CXX_20 void minIs(IndexSequence<I...>, const difference_type differenceType) {
             const std::initializer_list<int> expand = {
                 (std::get<I>(_iterators) = std::prev(std::get<I>(_iterators), differenceType), 0)...};
             static_cast<void>(expand);
         }
 
         template<std::size_t... I>
-        difference_type iteratorMin(IndexSequence<I...>, const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 difference_type iteratorMin(IndexSequence<I...>, const ZipIterator& other) const {
             const std::initializer_list<difference_type> diff =
                 {static_cast<difference_type>((std::distance(std::get<I>(other._iterators), std::get<I>(_iterators))))...};
             return static_cast<difference_type>(std::min(diff));
         }
 
         template<std::size_t... I>
-        bool lessThan(IndexSequence<I...>, const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool lessThan(IndexSequence<I...>, const ZipIterator& other) const {
             const std::initializer_list<difference_type> distances = {
                 (std::distance(std::get<I>(_iterators), std::get<I>(other._iterators)))...};
             return std::find_if(distances.begin(), distances.end(), [](const difference_type diff) {
@@ -70,7 +71,7 @@ namespace lz { namespace detail {
         }
 
         template<std::size_t... I>
-        bool notEqual(IndexSequence<I...>, const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool notEqual(IndexSequence<I...>, const ZipIterator& other) const {
             const std::initializer_list<bool> boolValues = {(std::get<I>(_iterators) != std::get<I>(other._iterators))...};
             const auto* const end = boolValues.end();
             // Check if false not in boolValues
@@ -78,13 +79,13 @@ namespace lz { namespace detail {
         }
 
     public:
-        explicit ZipIterator(const std::tuple<Iterators...>& iterators) :  // NOLINT(modernize-pass-by-value)
+        LZ_CONSTEXPR_CXX_20 explicit ZipIterator(const std::tuple<Iterators...>& iterators) :  // NOLINT(modernize-pass-by-value)
             _iterators(iterators) {
         }
 
         ZipIterator() = default;
 
-        reference operator*() const {
+        LZ_CONSTEXPR_CXX_20 reference operator*() const {
             return dereference(MakeIndexSequenceForThis());
         }
 
@@ -92,82 +93,208 @@ namespace lz { namespace detail {
             return FakePointerProxy<decltype(**this)>(**this);
         }
 
-        ZipIterator& operator++() {
+        LZ_CONSTEXPR_CXX_20 ZipIterator& operator++() {
             increment(MakeIndexSequenceForThis());
             return *this;
         }
 
-        ZipIterator operator++(int) {
+        LZ_CONSTEXPR_CXX_20 ZipIterator operator++(int) {
             ZipIterator tmp(*this);
             ++*this;
             return tmp;
         }
 
-        ZipIterator& operator--() {
+        LZ_CONSTEXPR_CXX_20 ZipIterator& operator--() {
             decrement(MakeIndexSequenceForThis());
             return *this;
         }
 
-        ZipIterator operator--(int) {
+        LZ_CONSTEXPR_CXX_20 ZipIterator operator--(int) {
             auto tmp(*this);
             --*this;
             return tmp;
         }
 
-        ZipIterator& operator+=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_20 ZipIterator& operator+=(const difference_type offset) {
             plusIs(MakeIndexSequenceForThis(), offset);
             return *this;
         }
 
-        ZipIterator operator+(const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_20 ZipIterator operator+(const difference_type offset) const {
             ZipIterator tmp(*this);
             tmp += offset;
             return tmp;
         }
 
-        ZipIterator& operator-=(const difference_type offset) {
+        LZ_CONSTEXPR_CXX_20 ZipIterator& operator-=(const difference_type offset) {
             minIs(MakeIndexSequenceForThis(), offset);
             return *this;
         }
 
-        ZipIterator operator-(const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_20 ZipIterator operator-(const difference_type offset) const {
             ZipIterator tmp(*this);
             tmp -= offset;
             return tmp;
         }
 
-        difference_type operator-(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 difference_type operator-(const ZipIterator& other) const {
             return iteratorMin(MakeIndexSequenceForThis(), other);
         }
 
-        reference operator[](const difference_type offset) const {
+        LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
             return *(*this + offset);
         }
 
-        bool operator==(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator==(const ZipIterator& other) const {
             return !(*this != other);
         }
 
-        bool operator!=(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator!=(const ZipIterator& other) const {
             return notEqual(MakeIndexSequenceForThis(), other);
         }
 
-        bool operator<(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator<(const ZipIterator& other) const {
             return lessThan(MakeIndexSequenceForThis(), other);
         }
 
-        bool operator>(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator>(const ZipIterator& other) const {
             return other < *this;
         }
 
-        bool operator<=(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator<=(const ZipIterator& other) const {
             return !(other < *this);
         }
 
-        bool operator>=(const ZipIterator& other) const {
+        LZ_CONSTEXPR_CXX_20 bool operator>=(const ZipIterator& other) const {
             return !(*this < other);
         }
     };
+
+    template<LZ_CONCEPT_ITERATOR... Iterators>
+    class RandomAccessZipIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        using MakeIndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
+        // The iterators are never moved, only the index is. This way every operation is done on one integer, so that
+        // iterating over a zip of random access iterators is as cheap as an indexed loop
+        std::tuple<Iterators...> _iterators{};
+        difference_type _index{};
+
+        template<std::size_t... I>
+        LZ_CONSTEXPR_CXX_17 reference dereference(IndexSequence<I...>) const {
+            return reference{std::get<I>(_iterators)[_index]...};
+        }
+
+    public:
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator(const std::tuple<Iterators...>& iterators, const difference_type index) :  // NOLINT(modernize-pass-by-value)
+            _iterators(iterators),
+            _index(index) {
+        }
+
+        RandomAccessZipIterator() = default;
+
+        LZ_CONSTEXPR_CXX_17 reference operator*() const {
+            return dereference(MakeIndexSequenceForThis());
+        }
+
+        pointer operator->() const {
+            return FakePointerProxy<decltype(**this)>(**this);
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator& operator++() {
+            ++_index;
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator operator++(int) {
+            RandomAccessZipIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator& operator--() {
+            --_index;
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator operator--(int) {
+            RandomAccessZipIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator& operator+=(const difference_type offset) {
+            _index += offset;
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator operator+(const difference_type offset) const {
+            RandomAccessZipIterator tmp(*this);
+            tmp += offset;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator& operator-=(const difference_type offset) {
+            _index -= offset;
+            return *this;
+        }
+
+        LZ_CONSTEXPR_CXX_17 RandomAccessZipIterator operator-(const difference_type offset) const {
+            RandomAccessZipIterator tmp(*this);
+            tmp -= offset;
+            return tmp;
+        }
+
+        LZ_CONSTEXPR_CXX_17 difference_type operator-(const RandomAccessZipIterator& other) const {
+            return _index - other._index;
+        }
+
+        LZ_CONSTEXPR_CXX_17 reference operator[](const difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator==(const RandomAccessZipIterator& other) const {
+            return _index == other._index;
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator!=(const RandomAccessZipIterator& other) const {
+            return _index != other._index;
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator<(const RandomAccessZipIterator& other) const {
+            return _index < other._index;
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator>(const RandomAccessZipIterator& other) const {
+            return other < *this;
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator<=(const RandomAccessZipIterator& other) const {
+            return !(other < *this);
+        }
+
+        LZ_CONSTEXPR_CXX_17 bool operator>=(const RandomAccessZipIterator& other) const {
+            return !(*this < other);
+        }
+    };
+
+    template<std::size_t... I, class... Iterators>
+    LZ_CONSTEXPR_CXX_17 std::ptrdiff_t smallestLength(IndexSequence<I...>, const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end) {
+        const std::initializer_list<std::ptrdiff_t> lengths = {
+            static_cast<std::ptrdiff_t>(std::get<I>(end) - std::get<I>(begin))...};
+        return (std::max)(static_cast<std::ptrdiff_t>(0), (std::min)(lengths));
+    }
+
+    // If all the iterators are random access, the length of the zip is calculated once and only an index is kept
+    template<LZ_CONCEPT_ITERATOR... Iterators>
+    using ZipIteratorFor = Conditional<IsAllRandomAccess<Iterators...>::value,
+                                       RandomAccessZipIterator<Iterators...>, ZipIterator<Iterators...>>;
 }}
 
 #endif
\ No newline at end of file
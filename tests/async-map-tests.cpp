@@ -0,0 +1,105 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+#include <catch.hpp>
+
+#include <Lz/AsyncMap.hpp>
+#include <Lz/Parallel.hpp>
+#include <Lz/Range.hpp>
+
+
+TEST_CASE("AsyncMap changing and creating elements", "[AsyncMap][Basic functionality]") {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    SECTION("Should yield the results in order") {
+        // Earlier elements take longer, so they complete after later ones
+        std::function<int(int)> slowSquare = [](const int i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10 - i));
+            return i * i;
+        };
+        auto squares = lz::asyncMap(vec, slowSquare, 4, 4);
+        CHECK(squares.toVector() == std::vector<int>{1, 4, 9, 16, 25, 36, 49, 64});
+    }
+
+    SECTION("Should not calculate more than window elements ahead") {
+        std::atomic<int> started(0);
+        std::function<int(int)> count = [&started](const int i) {
+            ++started;
+            return i;
+        };
+        auto counted = lz::asyncMap(vec, count, 2, 3);
+        auto it = counted.begin();
+        CHECK(*it == 1);
+        // The first element is read, so the other two elements of the window are submitted as well, but no more
+        for (int i = 0; i < 100 && started.load() < 3; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(started.load() == 3);
+        ++it;
+        CHECK(*it == 2);
+    }
+
+    SECTION("Should rethrow exceptions when the result is read") {
+        std::function<int(int)> throwOnThree = [](const int i) {
+            if (i == 3) {
+                throw std::runtime_error("three");
+            }
+            return i;
+        };
+        auto mapped = lz::asyncMap(vec, throwOnThree, 2, 2);
+        auto it = mapped.begin();
+        CHECK(*it == 1);
+        CHECK(*++it == 2);
+        ++it;
+        CHECK_THROWS_AS(*it, std::runtime_error);
+    }
+
+    SECTION("Should share a pool") {
+        lz::ThreadPool pool(2);
+        std::function<int(int)> timesTwo = [](const int i) { return i * 2; };
+        auto first = lz::asyncMap(vec, timesTwo, pool);
+        auto second = lz::asyncMap(vec, timesTwo, pool, 1);
+        CHECK(first.toVector() == second.toVector());
+        CHECK(pool.size() == 2);
+    }
+
+    SECTION("Should not deadlock when read within a task of its own pool") {
+        lz::ThreadPool pool(1);
+        std::function<int(int)> timesTwo = [](const int i) { return i * 2; };
+        std::atomic<int> sum(0);
+        lz::parallelForEach(lz::range(4), [&](int) { sum += lz::asyncMap(vec, timesTwo, pool, 2).sum(); },
+                            lz::par(pool));
+        CHECK(sum.load() == 4 * 72);
+    }
+
+    SECTION("Should be able to stop before the end") {
+        std::function<int(int)> identity = [](const int i) { return i; };
+        auto mapped = lz::asyncMap(vec, identity, 2, 8);
+        CHECK(*mapped.begin() == 1);
+        // Destroying the view waits for the remaining tasks
+    }
+}
+
+TEST_CASE("AsyncMap binary operations", "[AsyncMap][Binary ops]") {
+    std::vector<int> vec = {1, 2, 3};
+    std::function<int(int)> timesTen = [](const int i) { return i * 10; };
+    auto mapped = lz::asyncMap(vec, timesTen, 2);
+    auto it = mapped.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it++ == 10);
+        CHECK(*it == 20);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != mapped.end());
+        ++it;
+        ++it;
+        ++it;
+        CHECK(it == mapped.end());
+    }
+}
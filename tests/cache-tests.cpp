@@ -0,0 +1,98 @@
+#include <forward_list>
+#include <functional>
+#include <numeric>
+
+#include <catch.hpp>
+
+#include <Lz/Cache.hpp>
+#include <Lz/Map.hpp>
+
+
+TEST_CASE("Cache evaluates elements once", "[Cache][Basic functionality]") {
+    std::vector<int> vec = {1, 2, 3, 4};
+    std::size_t calls = 0;
+    std::function<int(int)> square = [&calls](const int i) {
+        ++calls;
+        return i * i;
+    };
+    auto squares = lz::map(vec, square);
+
+    SECTION("Should evaluate every element once if random access") {
+        auto cached = lz::cache(squares);
+        CHECK(cached.toVector() == std::vector<int>{1, 4, 9, 16});
+        CHECK(cached.toVector() == std::vector<int>{1, 4, 9, 16});
+        CHECK(*(cached.end() - 1) == 16);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should share the elements with copies") {
+        auto cached = lz::cache(squares);
+        auto copy = cached;
+        CHECK(*cached.begin() == 1);
+        CHECK(*copy.begin() == 1);
+        CHECK(&*copy.begin() == &*cached.begin());
+        CHECK(calls == 1);
+    }
+
+    SECTION("Should remember the last elements if forward") {
+        std::forward_list<int> list = {1, 2, 3, 4};
+        auto forward = lz::map(list, square);
+        auto cached = lz::cache(forward, 2);
+        using IterCat = std::iterator_traits<decltype(cached.begin())>::iterator_category;
+        static_assert(std::is_same<IterCat, std::forward_iterator_tag>::value, "Should be forward");
+
+        auto it = cached.begin();
+        CHECK(*it == 1);
+        CHECK(*it == 1);
+        CHECK(*++it == 4);
+        CHECK(*cached.begin() == 1);
+        CHECK(calls == 2);
+
+        ++it;
+        CHECK(*it == 9);
+        // The first element is evicted by the third one
+        CHECK(*cached.begin() == 1);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should keep the elements of iterators that share a slot if forward") {
+        std::forward_list<int> list(128);
+        std::iota(list.begin(), list.end(), 0);
+        auto cached = lz::cache(lz::map(list, square), 64);
+        auto it = cached.begin();
+        const int& first = *it;
+        const int& next = *std::next(it, 64);
+        CHECK(first == 0);
+        CHECK(next == 64 * 64);
+    }
+}
+
+TEST_CASE("Cache binary operations", "[Cache][Binary ops]") {
+    std::vector<int> vec = {1, 2, 3};
+    std::function<int(int)> timesTen = [](const int i) { return i * 10; };
+    auto cached = lz::cache(lz::map(vec, timesTen));
+    auto it = cached.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(*it == 20);
+    }
+
+    SECTION("Operator--") {
+        it = cached.end();
+        --it;
+        CHECK(*it == 30);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != cached.end());
+        it = cached.end();
+        CHECK(it == cached.end());
+    }
+
+    SECTION("Operator+(int), operator-(Iterator) and operator[]") {
+        CHECK(*(it + 2) == 30);
+        CHECK(cached.end() - it == 3);
+        CHECK(it[1] == 20);
+    }
+}
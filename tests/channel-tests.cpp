@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <Lz/Channel.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <Lz/Take.hpp>
+
+
+TEST_CASE("Channel changing and creating elements", "[Channel][Basic functionality]") {
+    SECTION("Should yield the elements of a single producer in order") {
+        auto channel = lz::channel<int>(16);
+        std::thread producer([channel]() mutable {
+            for (int i = 0; i < 10000; i++) {
+                channel.push(i);
+            }
+            channel.close();
+        });
+        int expected = 0;
+        for (const int i : channel) {
+            CHECK(i == expected);
+            expected++;
+        }
+        producer.join();
+        CHECK(expected == 10000);
+    }
+
+    SECTION("Should pass every element once with multiple producers and consumers") {
+        auto channel = lz::channel<int>(64);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 4; p++) {
+            producers.emplace_back([channel, p]() mutable {
+                if (p % 2 == 0) {
+                    for (int i = p * 1000; i < (p + 1) * 1000; i++) {
+                        channel.push(i);
+                    }
+                }
+                else {
+                    channel.pushBatch(lz::range(p * 1000, (p + 1) * 1000));
+                }
+            });
+        }
+        std::vector<std::vector<int>> received(3);
+        std::vector<std::thread> consumers;
+        for (std::size_t c = 0; c < received.size(); c++) {
+            // Every consumer reads its own copy of the channel
+            consumers.emplace_back([channel, &received, c]() {
+                received[c] = channel.toVector();
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        channel.close();
+        for (std::thread& consumer : consumers) {
+            consumer.join();
+        }
+        std::vector<int> all;
+        for (const std::vector<int>& part : received) {
+            all.insert(all.end(), part.begin(), part.end());
+        }
+        std::sort(all.begin(), all.end());
+        CHECK(all == lz::range(4000).toVector());
+    }
+
+    SECTION("Should apply backpressure") {
+        auto channel = lz::channel<std::string>(4);
+        CHECK(channel.capacity() == 4);
+        for (int i = 0; i < 4; i++) {
+            CHECK(channel.tryPush(std::to_string(i)));
+        }
+        std::string rejected = "rejected";
+        CHECK_FALSE(channel.tryPush(std::move(rejected)));
+        CHECK(rejected == "rejected");
+
+        std::string value;
+        CHECK(channel.tryPop(value));
+        CHECK(value == "0");
+        CHECK(channel.tryPush(std::string("4")));
+    }
+
+    SECTION("Should release a waiting producer when closed") {
+        auto channel = lz::channel<int>(2);
+        CHECK(channel.push(1));
+        CHECK(channel.push(2));
+        bool pushed = true;
+        std::thread producer([channel, &pushed]() mutable {
+            pushed = channel.push(3);
+        });
+        channel.close();
+        producer.join();
+        CHECK_FALSE(pushed);
+        CHECK(channel.isClosed());
+    }
+}
+
+TEST_CASE("Channel batches and close semantics", "[Channel][Batch]") {
+    SECTION("Should push and pop in batches") {
+        auto channel = lz::channel<int>(8);
+        std::vector<int> input = {1, 2, 3, 4, 5};
+        CHECK(channel.pushBatch(input) == 5);
+
+        std::vector<int> output;
+        CHECK(channel.popBatch(std::back_inserter(output), 3) == 3);
+        CHECK(output == std::vector<int>{1, 2, 3});
+        CHECK(channel.popBatch(std::back_inserter(output), 10) == 2);
+        CHECK(output == input);
+        CHECK(channel.popBatch(std::back_inserter(output), 0) == 0);
+    }
+
+    SECTION("Should drain the channel after it is closed") {
+        auto channel = lz::channel<int>(8);
+        channel.push(1);
+        channel.push(2);
+        channel.close();
+        CHECK_FALSE(channel.push(3));
+        CHECK(channel.pushBatch(std::vector<int>{4, 5}) == 0);
+
+        int value = 0;
+        CHECK(channel.pop(value));
+        CHECK(value == 1);
+        CHECK(channel.toVector() == std::vector<int>{2});
+        CHECK_FALSE(channel.pop(value));
+        CHECK_FALSE(channel.tryPop(value));
+        CHECK(channel.begin() == channel.end());
+    }
+}
+
+TEST_CASE("Channel composition", "[Channel][To container]") {
+    SECTION("Should compose with map, filter and terminals") {
+        auto channel = lz::channel<int>(16);
+        std::thread producer([channel]() mutable {
+            channel.pushBatch(lz::range(1, 101));
+            channel.close();
+        });
+        std::function<bool(int)> isEven = [](const int i) { return i % 2 == 0; };
+        std::function<int(int)> half = [](const int i) { return i / 2; };
+        auto halves = lz::map(lz::filter(channel, isEven), half);
+        CHECK(halves.sum() == 50 * 51 / 2);
+        producer.join();
+    }
+
+    SECTION("Should only pop the taken elements") {
+        auto channel = lz::channel<int>(16);
+        channel.pushBatch(lz::range(10));
+        channel.close();
+        CHECK(lz::take(channel, 3).toVector() == std::vector<int>{0, 1, 2});
+        CHECK(lz::take(channel, 3).toVector() == std::vector<int>{3, 4, 5});
+        CHECK(channel.toVector() == std::vector<int>{6, 7, 8, 9});
+        CHECK(lz::take(channel, 3).toVector().empty());
+    }
+}
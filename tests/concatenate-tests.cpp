@@ -24,6 +24,15 @@ TEST_CASE("Concat changing and creating elements", "[Concat][Basic functionality
         auto dist = static_cast<std::size_t>(std::distance(concat.begin(), concat.end()));
         CHECK(dist == a.size() + b.size());
     }
+
+    SECTION("Should split by segment") {
+        auto parts = concat.split(4);
+        REQUIRE(parts.size() == 3);
+        CHECK(parts[0].to<std::basic_string>() == "hel");
+        CHECK(parts[1].to<std::basic_string>() == "lo ");
+        CHECK(parts[2].to<std::basic_string>() == "world");
+        CHECK(concat.subrange(4, 8).to<std::basic_string>() == "o wo");
+    }
 }
 
 TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
@@ -56,6 +65,7 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
 
     SECTION("Operator+(int), tests += as well") {
         CHECK(*(begin + a.size()) == 'w');
+        CHECK(*(begin + a.size() + 2) == 'r');
     }
 
     SECTION("Operator-(int), tests -= as well") {
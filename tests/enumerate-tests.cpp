@@ -116,6 +116,13 @@ TEST_CASE("Enumerate to containers", "[Enumerate][To container]") {
         }
     }
 
+    SECTION("To columns") {
+        std::pair<std::vector<int>, std::vector<int>> columns = lz::enumerate(vec, 2).toColumns();
+
+        CHECK(columns.first == std::vector<int>{2, 3, 4});
+        CHECK(columns.second == vec);
+    }
+
     SECTION("To other container using to<>()") {
         std::list<std::pair<int, int>> actualList = lz::enumerate(vec).to<std::list>();
         auto expectedPair = std::make_pair(0, 1);
@@ -157,3 +164,12 @@ TEST_CASE("Enumerate to containers", "[Enumerate][To container]") {
         CHECK(actual == expected);
     }
 }
+
+#ifdef LZ_HAS_CXX_20
+TEST_CASE("Enumerate in constant expressions", "[Enumerate][Constexpr]") {
+    static constexpr std::array<int, 2> array = {5, 6};
+    constexpr std::array<std::pair<int, int>, 2> enumerated = lz::enumerate(array).toArray<2>();
+    static_assert(enumerated[1].first == 1 && enumerated[1].second == 6, "enumerate should be usable in constant expressions");
+    CHECK(enumerated[0] == std::make_pair(0, 5));
+}
+#endif
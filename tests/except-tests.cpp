@@ -50,6 +50,15 @@ TEST_CASE("Except binary operations", "[Except][Binary ops]") {
         CHECK(*it == 4);
     }
 
+    SECTION("Operator--") {
+        it = except.end();
+        --it;
+        CHECK(*it == 4);
+        --it;
+        CHECK(*it == 1);
+        CHECK(it == except.begin());
+    }
+
     SECTION("Operator== & operator!=") {
         CHECK(it != except.end());
         it = except.end();
@@ -1,8 +1,13 @@
+#include <forward_list>
+#include <functional>
 #include <list>
+#include <vector>
 
 #include <catch.hpp>
 
 #include <Lz/Filter.hpp>
+#include <Lz/Repeat.hpp>
+#include <Lz/Take.hpp>
 
 
 TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]") {
@@ -24,6 +29,99 @@ TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]")
         CHECK(it == filter.end());
     }
 
+    SECTION("Should pipe and combine filters") {
+        auto notThree = [](int element) { return element != 3; };
+        auto notOne = [](int element) { return element != 1; };
+
+        auto filter = array | lz::filter(notThree) | lz::filter(notOne);
+        CHECK(std::is_same<decltype(filter), decltype(lz::filter(array, lz::detail::ConjunctionPredicate<
+            decltype(notThree), decltype(notOne)>(notThree, notOne)))>::value);
+        CHECK(filter.toVector() == std::vector<int>{2});
+    }
+
+    SECTION("Should fuse a filter and a map into one iterator") {
+        auto notThree = [](int element) { return element != 3; };
+        auto timesTen = [](int element) { return element * 10; };
+        auto plusOne = [](int element) { return element + 1; };
+
+        auto filterMap = array | lz::filter(notThree) | lz::map(timesTen);
+#ifdef LZ_HAS_EXECUTION
+        using Fused = lz::FilterMap<std::execution::sequenced_policy, int*, decltype(notThree), decltype(timesTen)>;
+#else
+        using Fused = lz::FilterMap<int*, decltype(notThree), decltype(timesTen)>;
+#endif
+        CHECK(std::is_same<decltype(filterMap), Fused>::value);
+        CHECK(filterMap.toVector() == std::vector<int>{10, 20});
+        CHECK(*--filterMap.end() == 20);
+        // The fused iterator holds the same iterator pair as the filter iterator, next to the functions
+        CHECK(sizeof(decltype(filterMap.begin())) == sizeof(decltype(lz::filter(array, notThree).begin())));
+
+        auto composed = filterMap | lz::map(plusOne);
+        CHECK(sizeof(decltype(composed.begin())) == sizeof(decltype(filterMap.begin())));
+        CHECK(composed.toVector() == std::vector<int>{11, 21});
+    }
+
+    SECTION("Should store the end of the underlying sequence only") {
+        auto notThree = [](int element) { return element != 3; };
+        auto notOne = [](int element) { return element != 1; };
+
+        auto notTwo = [](int element) { return element != 2; };
+
+        auto inner = lz::filter(array, notThree);
+        auto middle = lz::filter(inner, notOne);
+        auto outer = lz::filter(middle, notTwo);
+        // Every level adds the end of `array`, instead of a copy of the iterator below it
+        CHECK(sizeof(decltype(outer.begin())) < 2 * sizeof(decltype(middle.begin())));
+        CHECK(middle.toVector() == std::vector<int>{2});
+        CHECK(outer.toVector().empty());
+    }
+
+    SECTION("Should filter infinite views") {
+        auto fours = lz::repeat(4);
+        auto even = lz::filter(fours, [](int element) { return element % 2 == 0; });
+        CHECK(lz::detail::IsInfinite<decltype(even)>::value);
+#ifdef LZ_HAS_NO_UNIQUE_ADDRESS
+        // The end of an infinite view is never reached, so it is not stored
+        CHECK(sizeof(decltype(even.begin())) == sizeof(decltype(fours.begin())));
+#endif
+        CHECK(lz::take(even, 3).toVector() == std::vector<int>{4, 4, 4});
+    }
+
+    SECTION("Should search for the first element only once") {
+        std::size_t calls = 0;
+        auto filter = lz::filter(array, [&calls](int element) {
+            ++calls;
+            return element == 3;
+        });
+        CHECK(calls == 3);
+
+        CHECK(*filter.begin() == 3);
+        CHECK(*filter.begin() == 3);
+        CHECK(calls == 3);
+    }
+
+    SECTION("Should split by source") {
+        std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        std::function<bool(int)> even = [](int element) { return element % 2 == 0; };
+        auto parts = lz::filter(vec, even).split(3);
+        REQUIRE(parts.size() == 3);
+        // The source is split from the first matching element
+        CHECK(parts[0].toVector() == std::vector<int>{2, 4});
+        CHECK(parts[1].toVector() == std::vector<int>{6});
+        CHECK(parts[2].toVector() == std::vector<int>{8, 10});
+
+        // Parts of the source without matching elements are left out
+        std::function<bool(int)> outer = [](int element) { return element == 1 || element == 10; };
+        CHECK(lz::filter(vec, outer).split(3).size() == 2);
+    }
+
+#ifdef LZ_HAS_NO_UNIQUE_ADDRESS
+    SECTION("Should not store empty predicates") {
+        auto filter = lz::filter(array, [](int element) { return element != 3; });
+        CHECK(sizeof(filter.begin()) == 2 * sizeof(int*));
+    }
+#endif
+
     SECTION("Should be by reference") {
         auto filter = lz::filter(array, [](int element) { return element != 3; });
         auto it = filter.begin();
@@ -47,6 +145,25 @@ TEST_CASE("Filter binary operations", "[Filter][Binary ops]") {
         CHECK(*it == array[1]);
     }
 
+    SECTION("Operator--") {
+        it = filter.end();
+        --it;
+        CHECK(*it == array[1]);
+        --it;
+        CHECK(*it == array[0]);
+        CHECK(it == filter.begin());
+    }
+
+    SECTION("Is bidirectional for bidirectional iterators only") {
+        using ArrayIterCat = std::iterator_traits<decltype(it)>::iterator_category;
+        static_assert(std::is_same<ArrayIterCat, std::bidirectional_iterator_tag>::value, "Should be bidirectional");
+
+        std::forward_list<int> forwardList = {1, 2, 3};
+        auto forwardFilter = lz::filter(forwardList, f);
+        using ForwardIterCat = std::iterator_traits<decltype(forwardFilter.begin())>::iterator_category;
+        static_assert(std::is_same<ForwardIterCat, std::forward_iterator_tag>::value, "Should be forward");
+    }
+
     SECTION("Operator== & operator!=") {
         CHECK(it != filter.end());
         it = filter.end();
@@ -123,3 +240,53 @@ TEST_CASE("Filter to container", "[Filter][To container]") {
         CHECK(expected == actual);
     }
 }
+
+TEST_CASE("Filter to selection", "[Filter][Selection]") {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    auto selection = lz::filter(vec, [&calls](const int i) {
+        ++calls;
+        return i % 2 == 0;
+    }).toSelection();
+
+    SECTION("Should evaluate the predicate once per element") {
+        CHECK(calls == static_cast<int>(vec.size()));
+    }
+
+    SECTION("Should be indexable in O(1)") {
+        CHECK(selection.size() == 3);
+        CHECK(selection[0] == 2);
+        CHECK(selection[1] == 4);
+        CHECK(selection[2] == 6);
+        CHECK(selection.end() - selection.begin() == 3);
+        CHECK(selection.begin()[2] == 6);
+    }
+
+    SECTION("Should refer to the original elements") {
+        selection[1] = 40;
+        CHECK(vec[3] == 40);
+    }
+
+    SECTION("Should stay valid after copying") {
+        auto copy = selection;
+        selection = lz::filter(vec, [](const int i) { return i > 5; }).toSelection();
+        CHECK(copy.toVector() == std::vector<int>{2, 4, 6});
+        CHECK(selection.toVector() == std::vector<int>{6});
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Should select in parallel") {
+        auto parallel = lz::filter(vec, [](const int i) { return i % 2 == 0; }, std::execution::par).toSelection();
+        CHECK(parallel.toVector() == std::vector<int>{2, 4, 6});
+    }
+#endif
+}
+
+#ifdef LZ_HAS_CXX_20
+TEST_CASE("Filter in constant expressions", "[Filter][Constexpr]") {
+    static constexpr std::array<int, 4> array = {1, 2, 3, 4};
+    constexpr std::array<int, 2> evens = lz::filter(array, [](const int i) { return i % 2 == 0; }).toArray<2>();
+    static_assert(evens[0] == 2 && evens[1] == 4, "filter should be usable in constant expressions");
+    CHECK(evens == std::array<int, 2>{2, 4});
+}
+#endif
@@ -1,3 +1,6 @@
+#include <list>
+#include <map>
+
 #include "Lz/FunctionTools.hpp"
 #include "Lz/Range.hpp"
 
@@ -5,6 +8,17 @@
 #include "catch.hpp"
 
 
+namespace {
+    // The substrings are std::string or std::string_view, depending on the standard
+    struct AddSize {
+        template<class String>
+        int operator()(const int i, const String& s) const {
+            return i + static_cast<int>(s.size());
+        }
+    };
+}
+
+
 TEST_CASE("Function tools") {
     std::vector<int> ints = {1, 2, 3, 4};
     std::vector<double> doubles = {1.2, 2.5, 3.3, 4.5};
@@ -14,6 +28,37 @@ TEST_CASE("Function tools") {
         CHECK(avg == Approx((1. + 2. + 3. + 4.) / 4.));
     }
 
+    SECTION("Terminal operations") {
+        std::list<int> list = {3, 1, 4, 1, 5};
+        auto odd = lz::filter(list, [](const int i) { return i % 2 != 0; });
+        CHECK(odd.count() == 4);
+        CHECK(odd.sum() == 10);
+        CHECK(odd.minMax() == std::make_pair(1, 5));
+        CHECK(odd.first() == 3);
+        CHECK(odd.any([](const int i) { return i > 4; }));
+        CHECK(!odd.all([](const int i) { return i > 1; }));
+        CHECK(lz::as<double>(doubles).sum() == Approx(1.2 + 2.5 + 3.3 + 4.5));
+        CHECK(lz::take(ints, 3).sum() == 6);
+
+        // Stops before 4 is added
+        auto sum = lz::take(ints, 4).foldWhile(0, std::plus<int>(), [](const int s) { return s < 6; });
+        CHECK(sum == 6);
+
+        std::vector<int> empty;
+        CHECK(lz::take(empty, 0).sum() == 0);
+        CHECK_THROWS_AS(lz::take(empty, 0).first(), std::invalid_argument);
+        CHECK_THROWS_AS(lz::take(empty, 0).max(), std::invalid_argument);
+        CHECK(lz::mean(odd) == Approx(2.5));
+
+        int calls = 0;
+        auto counted = lz::map(list, [&calls](const int i) {
+            ++calls;
+            return i;
+        });
+        CHECK(counted.minMax() == std::make_pair(1, 5));
+        CHECK(calls == 5);
+    }
+
     SECTION("Median") {
         double median = lz::median(doubles);
         CHECK(median == Approx((2.5 + 3.3) / 2.));
@@ -57,17 +102,134 @@ TEST_CASE("Function tools") {
     }
 #endif // end lz has cxx 17
 
+    SECTION("Reduce") {
+        CHECK(lz::reduce(ints, 0, std::plus<int>()) == 10);
+        CHECK(lz::reduce(lz::range(1, 101), 0, std::plus<int>()) == 5050);
+#ifdef LZ_HAS_EXECUTION
+        std::vector<int> many = lz::range(100000).toVector();
+        CHECK(lz::reduce(many, 0LL, std::plus<long long>(), std::execution::par) == 4999950000LL);
+        CHECK(lz::reduce(many, 0LL, std::plus<long long>(), std::execution::seq) == 4999950000LL);
+
+        // Only associativity is required, the order is kept
+        std::vector<std::string> words = lz::map(lz::range(1000), [](int i) { return std::to_string(i % 10); }).toVector();
+        const std::string expected = lz::reduce(words, std::string(), std::plus<std::string>());
+        CHECK(lz::reduce(words, std::string(), std::plus<std::string>(), std::execution::par) == expected);
+
+        std::size_t totalSize = lz::transAccumulate(words, std::size_t(0), [](std::size_t i, const std::string& s) {
+            return i + s.size();
+        }, std::plus<std::size_t>(), std::execution::par);
+        CHECK(totalSize == 1000);
+
+        // The delimiter overlaps itself, so the sequence cannot be split and is read in buffers instead
+        std::string repeated;
+        for (int i = 0; i < 10000; i++) {
+            repeated += "1  ";
+        }
+        auto splitter = lz::split(repeated, "  ");
+        CHECK(lz::transAccumulate(splitter, 0, AddSize(),
+                                  std::plus<int>(), std::execution::par) == 10000);
+#endif // end has execution
+    }
+
     SECTION("Pairwise") {
         auto x = lz::pairwise(ints).toVector();
         CHECK(x == std::vector<std::tuple<int, int>>{std::make_tuple(1, 2), std::make_tuple(2, 3), std::make_tuple(3, 4)});
     }
 
+    SECTION("Unzip") {
+        auto mapped = lz::map(ints, [](const int i) { return std::make_tuple(i, i * 2.); });
+        std::tuple<std::vector<int>, std::vector<double>> unzipped = lz::unzip(mapped);
+        CHECK(std::get<0>(unzipped) == ints);
+        CHECK(std::get<1>(unzipped) == std::vector<double>{2., 4., 6., 8.});
+
+        std::vector<int> evens;
+        std::list<double> doubled = {0.};
+        mapped.unzipTo(evens, doubled);
+        CHECK(evens == ints);
+        CHECK(doubled == std::list<double>{0., 2., 4., 6., 8.});
+
+        // Both outputs keep their geometric growth when they are reused for every batch
+        std::vector<int> firsts;
+        std::vector<double> seconds;
+        std::size_t reallocations = 0;
+        for (int i = 0; i < 1000; i++) {
+            const std::size_t capacity = firsts.capacity() + seconds.capacity();
+            mapped.unzipTo(firsts, seconds);
+            reallocations += firsts.capacity() + seconds.capacity() != capacity ? 1 : 0;
+        }
+        CHECK(seconds.size() == 4000);
+        CHECK(reallocations < 20);
+
+        std::vector<std::pair<int, char>> pairs = {std::make_pair(1, 'a'), std::make_pair(2, 'b')};
+        std::tuple<std::vector<int>, std::vector<char>> unzippedPairs = lz::unzip(pairs);
+        CHECK(std::get<0>(unzippedPairs) == std::vector<int>{1, 2});
+        CHECK(std::get<1>(unzippedPairs) == std::vector<char>{'a', 'b'});
+    }
+
+    SECTION("Into and copy to") {
+        std::vector<int> batch = {0};
+        lz::map(ints, [](const int i) { return i * 2; }).into(batch);
+        CHECK(batch == std::vector<int>{0, 2, 4, 6, 8});
+
+        const int* data = batch.data();
+        lz::range(3).into(batch, lz::IntoMode::Overwrite);
+        CHECK(batch == std::vector<int>{0, 1, 2});
+        CHECK(batch.data() == data);
+
+        std::list<int> list = {-1};
+        lz::take(ints, 2).into(list);
+        CHECK(list == std::list<int>{-1, 1, 2});
+
+        // Batches that are appended to a reused container keep its geometric growth
+        std::vector<std::tuple<int, int>> zipped;
+        std::size_t reallocations = 0;
+        for (int i = 0; i < 1000; i++) {
+            const std::size_t capacity = zipped.capacity();
+            lz::zip(ints, ints).into(zipped);
+            reallocations += zipped.capacity() != capacity ? 1 : 0;
+        }
+        CHECK(zipped.size() == 4000);
+        CHECK(reallocations < 20);
+
+        int buffer[4] = {};
+        int* last = lz::filter(ints, [](const int i) { return i % 2 == 0; }).copyTo(buffer);
+        CHECK(last == buffer + 2);
+        CHECK(buffer[0] == 2);
+        CHECK(buffer[1] == 4);
+    }
+
     SECTION("As") {
         auto floats = lz::as<float>(ints).toVector();
         CHECK(std::is_same<typename decltype(floats)::value_type, float>::value);
         CHECK(floats == std::vector<float>{1., 2., 3., 4.});
     }
 
+    SECTION("Projections") {
+        struct Person {
+            std::string name;
+            int age;
+        };
+        std::vector<Person> people = {{"Alice", 40}, {"Bob", 25}, {"Carol", 31}};
+
+        auto names = lz::project(people, &Person::name);
+        CHECK(&*names.begin() == &people[0].name);
+        CHECK(names.toVector() == std::vector<std::string>{"Alice", "Bob", "Carol"});
+
+        std::map<std::string, int> ages = {{"Alice", 40}, {"Bob", 25}};
+        CHECK(lz::keys(ages).toVector() == std::vector<std::string>{"Alice", "Bob"});
+        CHECK(&*lz::values(ages).begin() == &ages["Alice"]);
+
+        CHECK(lz::indexOf(people, 31, &Person::age) == 2);
+        CHECK(lz::indexOf(people, "Dave", &Person::name) == lz::npos);
+        CHECK(lz::findOrDefault(people, "Bob", Person{"Nobody", 0}, &Person::name).age == 25);
+        CHECK(lz::findOrDefault(people, 99, Person{"Nobody", 0}, &Person::age).name == "Nobody");
+        CHECK(lz::median(people, std::less<int>(), &Person::age) == Approx(31));
+
+        auto byName = lz::project(people, &Person::name).toMap([](const std::string& name) { return name.size(); });
+        CHECK(byName[3] == "Bob");
+        CHECK(lz::as<Person>(people).toMap(&Person::age)[40].name == "Alice");
+    }
+
     SECTION("Find or default") {
         std::vector<std::string> s = {"hello world!", "what's up"};
         std::string toFind = "hel";
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <Lz/MapMaybe.hpp>
+
+#ifdef LZ_HAS_CXX17
+#include <optional>
+#endif
+
+
+TEST_CASE("MapMaybe changing and creating elements", "[MapMaybe][Basic functionality]") {
+    std::map<std::string, int> ages = {{"Alice", 40}, {"Bob", 25}};
+    std::vector<std::string> names = {"Alice", "Dave", "Bob", "Erin"};
+    std::size_t calls = 0;
+    std::function<const int*(const std::string&)> findAge = [&ages, &calls](const std::string& name) -> const int* {
+        ++calls;
+        auto pos = ages.find(name);
+        return pos == ages.end() ? nullptr : &pos->second;
+    };
+
+    SECTION("Should yield the engaged results") {
+        auto found = lz::mapMaybe(names, findAge);
+        CHECK(found.toVector() == std::vector<int>{40, 25});
+        CHECK(calls == names.size());
+    }
+
+    SECTION("Should yield references to what the pointers point to") {
+        auto found = lz::mapMaybe(names, findAge);
+        CHECK(&*found.begin() == &ages["Alice"]);
+    }
+
+    SECTION("Should be empty if nothing is engaged") {
+        std::vector<std::string> unknown = {"Dave", "Erin"};
+        auto found = lz::mapMaybe(unknown, findAge);
+        CHECK(found.begin() == found.end());
+    }
+
+#ifdef LZ_HAS_CXX17
+    SECTION("Should yield the values of optionals") {
+        std::vector<std::string> tokens = {"1", "a", "23", "", "4"};
+        std::function<std::optional<int>(const std::string&)> tryParse = [&calls](const std::string& s) -> std::optional<int> {
+            ++calls;
+            if (s.empty() || !std::all_of(s.begin(), s.end(), [](const char c) { return std::isdigit(c) != 0; })) {
+                return std::nullopt;
+            }
+            return std::stoi(s);
+        };
+        auto parsed = lz::mapMaybe(tokens, tryParse);
+        CHECK(parsed.toVector() == std::vector<int>{1, 23, 4});
+        CHECK(calls == tokens.size());
+    }
+#endif
+}
+
+TEST_CASE("MapMaybe binary operations", "[MapMaybe][Binary ops]") {
+    std::vector<int> vec = {1, 2, 3, 4};
+    std::function<const int*(const int&)> even = [](const int& i) { return i % 2 == 0 ? &i : nullptr; };
+    auto evens = lz::mapMaybe(vec, even);
+    auto it = evens.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 4);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != evens.end());
+        ++it;
+        ++it;
+        CHECK(it == evens.end());
+    }
+}
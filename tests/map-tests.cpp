@@ -1,8 +1,12 @@
+#include <functional>
 #include <list>
+#include <string>
+#include <vector>
 
 #include <catch.hpp>
 
 #include <Lz/Map.hpp>
+#include <Lz/Zip.hpp>
 
 
 struct TestStruct {
@@ -42,6 +46,55 @@ TEST_CASE("Map changing and creating elements", "[Map][Basic functionality]") {
             static_cast<void>(_);
         }
     }
+
+    SECTION("Should yield the references that are returned") {
+        auto map = lz::map(array, [](TestStruct& t) -> std::string& { return t.testFieldStr; });
+        CHECK(std::is_same<decltype(*map.begin()), std::string&>::value);
+        CHECK(&*map.begin() == &array[0].testFieldStr);
+        *map.begin() = "Changed";
+        CHECK(array[0].testFieldStr == "Changed");
+    }
+
+    SECTION("Should copy the references into temporaries") {
+        auto byValue = lz::map(array, [](const TestStruct& t) { return t; });
+        std::function<const std::string&(const TestStruct&)> getString = [](const TestStruct& t) -> const std::string& {
+            return t.testFieldStr;
+        };
+        auto map = lz::map(byValue, getString);
+        CHECK(std::is_same<decltype(*map.begin()), std::string>::value);
+        CHECK(map.toVector() == std::vector<std::string>{"FieldA", "FieldB", "FieldC"});
+
+        auto composed = array | lz::map([](const TestStruct& t) { return t; }) | lz::map(getString);
+        CHECK(std::is_same<decltype(*composed.begin()), std::string>::value);
+        CHECK(*composed.begin() == "FieldA");
+    }
+
+    SECTION("Should pipe and compose maps") {
+        auto getInt = [](const TestStruct& t) { return t.testFieldInt; };
+        auto timesTwo = [](const int i) { return i * 2; };
+
+        auto map = array | lz::map(getInt) | lz::map(timesTwo);
+        CHECK(std::is_same<decltype(map.begin()), lz::detail::MapIterator<TestStruct*,
+            lz::detail::ComposedFunction<decltype(timesTwo), decltype(getInt)>>>::value);
+        CHECK(map.toVector() == std::vector<int>{2, 4, 6});
+    }
+
+    SECTION("Should not index a zip of lists") {
+        std::list<int> list = {1, 2, 3};
+        auto zipped = lz::zip(list, list);
+        CHECK(std::is_same<std::iterator_traits<decltype(zipped.begin())>::iterator_category,
+                           std::bidirectional_iterator_tag>::value);
+
+        auto sums = lz::map(zipped, [](const std::tuple<int&, int&>& t) { return std::get<0>(t) + std::get<1>(t); });
+        CHECK(sums.toVector() == std::vector<int>{2, 4, 6});
+    }
+
+#ifdef LZ_HAS_NO_UNIQUE_ADDRESS
+    SECTION("Should not store empty functions") {
+        auto getInt = [](const TestStruct& t) { return t.testFieldInt; };
+        CHECK(sizeof(decltype(lz::map(array, getInt).begin())) == sizeof(TestStruct*));
+    }
+#endif
 }
 
 
@@ -169,3 +222,12 @@ TEST_CASE("Map to containers", "[Map][To container]") {
         CHECK(actual == expected);
     }
 }
+
+#ifdef LZ_HAS_CXX17
+TEST_CASE("Map in constant expressions", "[Map][Constexpr]") {
+    static constexpr std::array<int, 4> array = {1, 2, 3, 4};
+    constexpr std::array<int, 4> squares = lz::map(array, [](const int i) { return i * i; }).toArray<4>();
+    static_assert(squares[0] == 1 && squares[3] == 16, "map should be usable in constant expressions");
+    CHECK(squares == std::array<int, 4>{1, 4, 9, 16});
+}
+#endif
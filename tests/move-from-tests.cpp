@@ -0,0 +1,31 @@
+#include <catch.hpp>
+
+#include <Lz/MoveFrom.hpp>
+#include <Lz/Range.hpp>
+#include <Lz/Take.hpp>
+
+
+TEST_CASE("MoveFrom moves elements", "[MoveFrom][Basic functionality]") {
+    std::vector<std::string> strings = {std::string(32, 'a'), std::string(32, 'b'), std::string(32, 'c')};
+    const char* data = strings[0].data();
+
+    SECTION("Should move into a vector") {
+        std::vector<std::string> moved = lz::moveFrom(lz::take(strings, 2)).toVector();
+        CHECK(moved == std::vector<std::string>{std::string(32, 'a'), std::string(32, 'b')});
+        CHECK(moved[0].data() == data);
+        CHECK(strings[2] == std::string(32, 'c'));
+    }
+
+    SECTION("Should yield rvalues") {
+        auto moveFrom = lz::moveFrom(strings);
+        static_assert(std::is_same<decltype(*moveFrom.begin()), std::string&&>::value, "Should yield rvalues");
+        std::string first = *moveFrom.begin();
+        CHECK(first.data() == data);
+    }
+
+    SECTION("Should not wrap views that yield values") {
+        auto range = lz::moveFrom(lz::range(3));
+        static_assert(std::is_same<decltype(range.begin()), lz::detail::RangeIterator<int>>::value, "Should not be wrapped");
+        CHECK(range.toVector() == std::vector<int>{0, 1, 2});
+    }
+}
@@ -0,0 +1,68 @@
+#include <list>
+
+#include <catch.hpp>
+
+#include <Lz/Own.hpp>
+#include <Lz/Map.hpp>
+
+
+namespace {
+    auto squares(const int amount) -> decltype(lz::map(lz::own(std::vector<int>()), std::negate<int>())) {
+        std::vector<int> values;
+        for (int i = 1; i <= amount; i++) {
+            values.push_back(i * i);
+        }
+        // The vector is owned by the map object, so it does not dangle
+        return lz::map(lz::own(std::move(values)), std::negate<int>());
+    }
+}
+
+TEST_CASE("Own keeps the container alive", "[Own][Basic functionality]") {
+    SECTION("Should own the container") {
+        std::vector<int> vec = {1, 2, 3};
+        const int* data = vec.data();
+        auto owned = lz::own(std::move(vec));
+        CHECK(&*owned.begin() == data);
+        CHECK(owned.toVector() == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Views created from it should keep it alive") {
+        auto negated = squares(3);
+        CHECK(negated.toVector() == std::vector<int>{-1, -4, -9});
+    }
+
+    SECTION("Should keep the iterator category") {
+        auto owned = lz::own(std::list<int>{1, 2, 3});
+        using IterCat = std::iterator_traits<decltype(owned.begin())>::iterator_category;
+        static_assert(std::is_same<IterCat, std::bidirectional_iterator_tag>::value, "Should be bidirectional");
+        CHECK(*--owned.end() == 3);
+    }
+}
+
+TEST_CASE("Own binary operations", "[Own][Binary ops]") {
+    auto owned = lz::own(std::vector<int>{1, 2, 3});
+    auto it = owned.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(*it == 2);
+    }
+
+    SECTION("Operator--") {
+        it = owned.end();
+        --it;
+        CHECK(*it == 3);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != owned.end());
+        it = owned.end();
+        CHECK(it == owned.end());
+    }
+
+    SECTION("Operator+(int), operator-(Iterator) and operator[]") {
+        CHECK(*(it + 2) == 3);
+        CHECK(owned.end() - it == 3);
+        CHECK(it[1] == 2);
+    }
+}
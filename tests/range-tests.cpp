@@ -51,6 +51,25 @@ TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]"
     }
 }
 
+TEST_CASE("Range split and subrange", "[Range][Split]") {
+    auto range = lz::range(10);
+
+    SECTION("Should split by index") {
+        auto parts = range.split(3);
+        REQUIRE(parts.size() == 3);
+        CHECK(parts[0].toVector() == std::vector<int>{0, 1, 2});
+        CHECK(parts[1].toVector() == std::vector<int>{3, 4, 5});
+        CHECK(parts[2].toVector() == std::vector<int>{6, 7, 8, 9});
+        CHECK(lz::range(2).split(3).size() == 2);
+        CHECK(lz::range(0).split(3).empty());
+    }
+
+    SECTION("Should create subranges") {
+        CHECK(range.subrange(2, 5).toVector() == std::vector<int>{2, 3, 4});
+        CHECK(range.subrange(4, 4).toVector().empty());
+    }
+}
+
 TEST_CASE("Range binary operations", "[Range][Binary ops]") {
     constexpr int size = 10;
     auto range = lz::range(size);
@@ -130,6 +149,14 @@ TEST_CASE("Range to containers", "[Range][To container]") {
         CHECK(expected == actual);
     }
 
+    SECTION("To vector with steps") {
+        CHECK(lz::range(0, 10, 3).toVector() == std::vector<int>{0, 3, 6, 9});
+        CHECK(lz::range(0, 9, 3).toVector() == std::vector<int>{0, 3, 6});
+        CHECK(lz::range(10, 0, -4).toVector() == std::vector<int>{10, 6, 2});
+        CHECK(lz::range(5, 5).toVector().empty());
+        CHECK(lz::range(0.0, 1.0, 0.25).toVector() == std::vector<double>{0.0, 0.25, 0.5, 0.75});
+    }
+
     SECTION("To map") {
         std::map<int, int> expected = range.toMap([](const int i) { return i; });
         std::map<int, int> actual;
@@ -152,3 +179,42 @@ TEST_CASE("Range to containers", "[Range][To container]") {
         CHECK(expected == actual);
     }
 }
+
+TEST_CASE("Range terminal operations", "[Range][Terminal]") {
+    SECTION("Sum") {
+        for (int step : {1, 2, 3, 7}) {
+            auto range = lz::range(-5, 20, step);
+            int expected = 0;
+            for (int i : range) {
+                expected += i;
+            }
+            CHECK(range.sum() == expected);
+        }
+        CHECK(lz::range(10, 0, -3).sum() == 10 + 7 + 4 + 1);
+        CHECK(lz::range(0).sum() == 0);
+    }
+
+    SECTION("Min and max") {
+        CHECK(lz::range(3, 20, 4).minMax() == std::make_pair(3, 19));
+        CHECK(lz::range(10, 0, -3).minMax() == std::make_pair(1, 10));
+        CHECK(lz::range(5).min() == 0);
+        CHECK(lz::range(5).max() == 4);
+        CHECK_THROWS_AS(lz::range(0).min(), std::invalid_argument);
+    }
+
+    SECTION("Count") {
+        CHECK(lz::range(0, 10, 3).count() == 4);
+        CHECK(lz::range(0.0, 1.0, 0.3).count() == 4);
+        CHECK(lz::range(0.0, 1.0, 0.3).count() == lz::range(0.0, 1.0, 0.3).toVector().size());
+        CHECK(lz::range(1.0, 0.0, -0.3).count() == 4);
+        CHECK(lz::range(0.0, 1.0, 0.25).count() == 4);
+    }
+}
+
+#ifdef LZ_HAS_CXX17
+TEST_CASE("Range in constant expressions", "[Range][Constexpr]") {
+    constexpr std::array<int, 4> array = lz::range(4).toArray<4>();
+    static_assert(array[0] == 0 && array[3] == 3, "range should be usable in constant expressions");
+    CHECK(array == std::array<int, 4>{0, 1, 2, 3});
+}
+#endif
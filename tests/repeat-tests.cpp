@@ -23,6 +23,28 @@ TEST_CASE("Repeat changing and creating elements", "[Repeat][Basic functionality
         auto start = repeater.begin();
         CHECK(&(*start) != &toRepeat);
     }
+
+    SECTION("Copy should repeat its own value") {
+        auto copy = repeater;
+        CHECK(&(*copy.begin()) != &(*repeater.begin()));
+        CHECK(std::distance(copy.begin(), copy.end()) == 5);
+        CHECK(*copy.begin() == 20);
+    }
+
+    SECTION("While true loop should not reach its end") {
+        auto infinite = lz::repeat(toRepeat);
+        auto it = infinite.begin();
+        std::advance(it, 100);
+        CHECK(it != infinite.end());
+        CHECK(*it == 20);
+    }
+
+    SECTION("Terminal operations") {
+        CHECK(repeater.sum() == 100);
+        CHECK(repeater.minMax() == std::make_pair(20, 20));
+        CHECK(repeater.count() == 5);
+        CHECK(lz::repeat(std::string("ab"), 3).sum() == "ababab");
+    }
 }
 
 
@@ -0,0 +1,101 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <Lz/Stage.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+
+
+TEST_CASE("Stage changing and creating elements", "[Stage][Basic functionality]") {
+    SECTION("Should yield the elements in order") {
+        std::function<int(int)> square = [](const int i) { return i * i; };
+        auto staged = lz::stage(lz::map(lz::range(10000), square), 16);
+        int expected = 0;
+        for (const int i : staged) {
+            CHECK(i == expected * expected);
+            expected++;
+        }
+        CHECK(expected == 10000);
+    }
+
+    SECTION("Should read upstream on another thread") {
+        const std::thread::id consumer = std::this_thread::get_id();
+        std::function<bool(int)> onProducer = [consumer](int) { return std::this_thread::get_id() != consumer; };
+        auto staged = lz::stage(lz::map(lz::range(100), onProducer), 8);
+        CHECK(staged.all([](const bool b) { return b; }));
+    }
+
+    SECTION("Should not read more than capacity elements ahead") {
+        std::atomic<int> read(0);
+        std::function<int(int)> count = [&read](const int i) {
+            ++read;
+            return i;
+        };
+        auto staged = lz::stage(lz::map(lz::range(100), count), 4);
+        auto it = staged.begin();
+        CHECK(*it == 0);
+        for (int i = 0; i < 100 && read.load() < 5; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        // The queue is full, and the producer holds one more element that it tries to push
+        CHECK(read.load() == 5);
+        ++it;
+        CHECK(*it == 1);
+    }
+
+    SECTION("Should rethrow exceptions of the upstream sequence") {
+        std::function<int(int)> throwAtThree = [](const int i) {
+            if (i == 3) {
+                throw std::runtime_error("three");
+            }
+            return i;
+        };
+        auto staged = lz::stage(lz::map(lz::range(10), throwAtThree), 4);
+        auto it = staged.begin();
+        CHECK(*it == 0);
+        ++it, ++it, ++it;
+        CHECK_THROWS_AS(it == staged.end(), std::runtime_error);
+    }
+
+    SECTION("Should stop the producer if the view is destroyed") {
+        std::vector<int> first;
+        {
+            auto staged = lz::stage(lz::range(1000000), 2);
+            auto it = staged.begin();
+            first.push_back(*it);
+        }
+        CHECK(first == std::vector<int>{0});
+    }
+
+    SECTION("Should not read further once the view is destroyed") {
+        std::atomic<int> read(0);
+        std::function<int(int)> slow = [&read](const int i) {
+            ++read;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return i;
+        };
+        const auto start = std::chrono::steady_clock::now();
+        {
+            auto staged = lz::stage(lz::map(lz::range(1000), slow), 200);
+            CHECK(*staged.begin() == 0);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        // Only the element that the producer was reading is finished, instead of filling the buffer
+        CHECK(elapsed < std::chrono::milliseconds(500));
+        CHECK(read.load() < 10);
+    }
+
+    SECTION("Should compose with other views and terminals") {
+        std::vector<int> vec = {1, 2, 3, 4, 5};
+        CHECK(lz::stage(vec, 2).sum() == 15);
+        std::vector<int> empty;
+        CHECK(lz::stage(empty, 2).toVector().empty());
+    }
+}
@@ -19,6 +19,47 @@ TEST_CASE("String splitter changing and creating elements", "[String splitter][B
         }
     }
 
+    SECTION("Copy should split on delimiter") {
+        auto copy = splitter;
+        std::vector<std::string> expected = {"Hello", "world", "test", "123"};
+        std::vector<std::string> actual;
+
+        for (auto&& substring : copy) {
+            actual.emplace_back(substring);
+        }
+        CHECK(actual == expected);
+    }
+
+    SECTION("Should own rvalue strings") {
+        auto owning = lz::split(std::string(toSplit), "  ");
+        auto moved = std::move(owning);
+        toSplit.clear();
+        std::vector<std::string> expected = {"Hello", "world", "test", "123"};
+        std::vector<std::string> actual;
+
+        for (auto&& substring : moved) {
+            actual.emplace_back(substring);
+        }
+        CHECK(actual == expected);
+    }
+
+    SECTION("Should split after a delimiter") {
+        auto commas = lz::split(std::string("a,bb,ccc,dddd,e,ff"), ",");
+        auto parts = commas.split(3);
+        REQUIRE(parts.size() == 3);
+        std::vector<std::string> actual;
+        for (auto& part : parts) {
+            CHECK(part.begin() != part.end());
+            for (auto&& substring : part) {
+                actual.emplace_back(substring);
+            }
+        }
+        CHECK(actual == std::vector<std::string>{"a", "bb", "ccc", "dddd", "e", "ff"});
+
+        // The delimiter can overlap itself, so the string is not split
+        CHECK(splitter.split(3).size() == 1);
+    }
+
 #ifndef LZ_HAS_STRING_VIEW
     SECTION("Should be std::string") {
         CHECK(std::is_same<decltype(*it), std::string&>::value);
@@ -35,6 +35,16 @@ TEST_CASE("TakeEvery changing and creating elements", "[TakeEvery][Basic functio
         ++iterator;
         CHECK(iterator == takeEvery.end());
     }
+
+    SECTION("TakeEvery should stop at the end of the skipped sequence") {
+        takeEvery = lz::takeEvery(array, 3, 2);
+        CHECK(takeEvery.toVector() == std::vector<int>{3});
+    }
+
+    SECTION("TakeEvery should not store the end of the sequence") {
+        // The end is reached by counting the elements, next to the offset
+        CHECK(sizeof(decltype(iterator)) == sizeof(int*) + 3 * sizeof(std::size_t));
+    }
 }
 
 
@@ -135,6 +135,16 @@ TEST_CASE("Take to containers", "[Take][To container]") {
         CHECK(expected == actual);
     }
 
+    SECTION("To containers from contiguous memory") {
+        std::vector<double> vec = {1.5, 2.5, 3.5, 4.5, 5.5};
+        CHECK(lz::slice(vec, 1, 4).toVector() == std::vector<double>{2.5, 3.5, 4.5});
+        CHECK(lz::slice(vec, 2, 2).toVector().empty());
+        CHECK(lz::takeRange(vec.data() + 3, vec.data() + vec.size()).toVector() == std::vector<double>{4.5, 5.5});
+
+        std::string str = "hello world";
+        CHECK(lz::take(str, 5).to<std::basic_string>() == "hello");
+    }
+
     SECTION("To map") {
         constexpr std::size_t newSize = 2;
         std::map<int, int> actual = lz::take(array, newSize).toMap([](const int i) { return i; });
@@ -171,6 +181,19 @@ TEST_CASE("DropWhile changing and creating elements", "[DropWhile][Basic functio
         CHECK(arr[2] == 0);
     }
 
+    SECTION("Should drop elements only once") {
+        std::size_t calls = 0;
+        auto counted = lz::dropWhile(arr, [&calls](const int i) {
+            ++calls;
+            return i == 1;
+        });
+        CHECK(calls == 3);
+
+        CHECK(*counted.begin() == 2);
+        CHECK(std::distance(counted.begin(), counted.end()) == 2);
+        CHECK(calls == 3);
+    }
+
     SECTION("Should not drop last element") {
         ++begin;
         CHECK(*begin == 1);
@@ -0,0 +1,167 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <Lz/Parallel.hpp>
+#include <Lz/Range.hpp>
+
+
+namespace {
+    // The substrings are std::string or std::string_view, depending on the standard
+    struct AddSize {
+        template<class String>
+        int operator()(const int i, const String& s) const {
+            return i + static_cast<int>(s.size());
+        }
+    };
+}
+
+
+TEST_CASE("Thread pool executing tasks", "[ThreadPool][Basic functionality]") {
+    lz::ThreadPool pool(4);
+    CHECK(pool.size() == 4);
+
+    SECTION("Should execute all tasks") {
+        std::atomic<int> executed(0);
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 100; i++) {
+            futures.push_back(pool.submit([i, &executed] {
+                ++executed;
+                return i * 2;
+            }));
+        }
+        for (int i = 0; i < 100; i++) {
+            CHECK(futures[static_cast<std::size_t>(i)].get() == i * 2);
+        }
+        CHECK(executed.load() == 100);
+    }
+
+    SECTION("Should rethrow exceptions of tasks") {
+        std::future<int> future = pool.submit([]() -> int { throw std::runtime_error("task"); });
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
+    }
+
+    SECTION("Should not deadlock if tasks wait for tasks") {
+        lz::ThreadPool single(1);
+        std::future<int> outer = single.submit([&single] {
+            std::future<int> inner = single.submit([] { return 1; });
+            single.wait(inner);
+            return inner.get() + 1;
+        });
+        single.wait(outer);
+        CHECK(outer.get() == 2);
+    }
+
+    SECTION("Should wait for a task that is already running") {
+        std::future<int> future = pool.submit([] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            return 1;
+        });
+        pool.wait(future);
+        CHECK(future.get() == 1);
+    }
+
+    SECTION("Should execute the remaining tasks when destroyed") {
+        std::atomic<int> executed(0);
+        {
+            lz::ThreadPool temporary(2);
+            for (int i = 0; i < 50; i++) {
+                temporary.submit([&executed] { ++executed; });
+            }
+        }
+        CHECK(executed.load() == 50);
+    }
+}
+
+TEST_CASE("Parallel algorithms with lz::par", "[ThreadPool][Par]") {
+    lz::ThreadPool pool(4);
+    std::vector<int> vec = lz::range(10000).toVector();
+
+    SECTION("toVector and copyTo") {
+        std::function<int(int)> square = [](const int i) { return i * i; };
+        auto squares = lz::map(vec, square);
+        CHECK(squares.toVector(lz::par(pool)) == squares.toVector());
+
+        std::vector<int> output(vec.size());
+        CHECK(squares.copyTo(output.begin(), lz::par(pool)) == output.end());
+        CHECK(output == squares.toVector());
+    }
+
+    SECTION("indexOf and indexOfIf") {
+        CHECK(lz::indexOf(vec, 7777, lz::par(pool)) == 7777);
+        CHECK(lz::indexOf(vec, -1, lz::par(pool)) == lz::npos);
+        CHECK(lz::indexOfIf(vec, [](const int i) { return i > 100 && i % 1000 == 0; }, lz::par(pool)) == 1000);
+        std::vector<int> empty;
+        CHECK(lz::indexOf(empty, 1, lz::par(pool)) == lz::npos);
+    }
+
+    SECTION("toString") {
+        CHECK(lz::range(10000).toString(", ", lz::par(pool)) == lz::range(10000).toString(", "));
+        CHECK(lz::range(5).toString("", lz::par(pool)) == "01234");
+        CHECK(lz::range(0).toString(", ", lz::par(pool)).empty());
+    }
+
+    SECTION("toSelection") {
+        auto even = lz::filter(vec, [](const int i) { return i % 2 == 0; });
+        auto selection = even.toSelection(lz::par(pool));
+        CHECK(selection.size() == 5000);
+        CHECK(selection.toVector() == even.toVector());
+    }
+
+    SECTION("parallelForEach and parallelReduce") {
+        std::function<long long(int)> square = [](const int i) { return static_cast<long long>(i) * i; };
+        auto squares = lz::map(lz::filter(vec, [](const int i) { return i % 2 == 0; }), square);
+        long long expected = 0;
+        for (long long i : squares) {
+            expected += i;
+        }
+
+        std::atomic<long long> sum(0);
+        lz::parallelForEach(squares, [&sum](const long long i) { sum += i; }, lz::par(pool));
+        CHECK(sum.load() == expected);
+        CHECK(lz::parallelReduce(squares, 0LL, std::plus<long long>(), lz::par(pool)) == expected);
+        CHECK(lz::parallelReduce(std::vector<int>(), 5, std::plus<int>(), lz::par(pool)) == 5);
+
+        // Only associativity is required, the order is kept
+        std::vector<std::string> words = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+        CHECK(lz::parallelReduce(words, std::string(">"), std::plus<std::string>(), lz::par(pool)) == ">abcdefghij");
+    }
+
+    SECTION("reduce and transAccumulate") {
+        CHECK(lz::reduce(vec, 0LL, std::plus<long long>(), lz::par(pool)) == 49995000LL);
+        std::vector<std::string> words = {"a", "bb", "ccc"};
+        CHECK(lz::transAccumulate(words, std::size_t(1), [](std::size_t i, const std::string& s) { return i + s.size(); },
+                                  std::plus<std::size_t>(), lz::par(pool)) == 7);
+
+        // Split after the delimiter
+        std::string csv;
+        for (int i = 0; i < 10000; i++) {
+            csv += "12,";
+        }
+        auto fields = lz::split(csv, ",");
+        CHECK(lz::transAccumulate(fields, 0, AddSize(),
+                                  std::plus<int>(), lz::par(pool)) == 20000);
+
+        // The delimiter overlaps itself, so the sequence is read in buffers instead
+        std::string spaced;
+        for (int i = 0; i < 10000; i++) {
+            spaced += "1  ";
+        }
+        auto ones = lz::split(spaced, "  ");
+        CHECK(lz::transAccumulate(ones, 0, AddSize(),
+                                  std::plus<int>(), lz::par(pool)) == 10000);
+    }
+
+    SECTION("Non random access sequences are processed on the calling thread") {
+        auto even = lz::filter(vec, [](const int i) { return i % 2 == 0; });
+        CHECK(even.toVector(lz::par(pool)) == even.toVector());
+        CHECK(lz::indexOf(even, 20, lz::par(pool)) == 10);
+        CHECK(even.toString(" ", lz::par(pool)) == even.toString(" "));
+    }
+}
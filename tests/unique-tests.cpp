@@ -1,5 +1,7 @@
 #include <Lz/Unique.hpp>
+#include <Lz/FunctionTools.hpp>
 #include <list>
+#include <vector>
 #include <catch.hpp>
 
 TEST_CASE("Unique changing and creating elements", "[Unique][Basic functionality]") {
@@ -19,6 +21,21 @@ TEST_CASE("Unique changing and creating elements", "[Unique][Basic functionality
         std::array<int, size> expected = {1, 2, 3};
         CHECK(expected == unique.toArray<size>());
     }
+
+    SECTION("Should be unique by projection") {
+        std::vector<std::pair<int, char>> pairs = {{2, 'a'}, {1, 'b'}, {2, 'c'}, {3, 'd'}, {1, 'e'}};
+        auto uniqueFirst = lz::unique(pairs, &std::pair<int, char>::first);
+        CHECK(lz::project(uniqueFirst, &std::pair<int, char>::first).toVector() == std::vector<int>{1, 2, 3});
+
+        auto it = uniqueFirst.end();
+        --it;
+        CHECK(it->first == 3);
+        --it;
+        CHECK(it->first == 2);
+
+        auto byParity = lz::unique(arr, [](const int i) { return i % 2; });
+        CHECK(std::distance(byParity.begin(), byParity.end()) == 2);
+    }
 }
 
 TEST_CASE("Unique binary operations", "[Unique][Binary ops]") {
@@ -31,6 +48,17 @@ TEST_CASE("Unique binary operations", "[Unique][Binary ops]") {
         CHECK(*beg == 2);
     }
 
+    SECTION("Operator--") {
+        auto end = unique.end();
+        --end;
+        CHECK(*end == 3);
+        --end;
+        CHECK(*end == 2);
+        --end;
+        CHECK(*end == 1);
+        CHECK(end == beg);
+    }
+
     SECTION("Operator==, operator!=") {
         CHECK(beg != unique.end());
         beg = unique.end();
@@ -29,6 +29,19 @@ TEST_CASE("Zip changing and creating elements", "[Zip][Basic functionality]") {
         CHECK(counter == smallest.size());
     }
 
+    SECTION("Should zip non random access iterators") {
+        std::list<int> list = {1, 2, 3};
+        std::size_t i = 0;
+
+        for (const auto& tup : lz::zip(a, list)) {
+            CHECK(std::get<0>(tup) == a[i]);
+            CHECK(std::get<1>(tup) == static_cast<int>(i) + 1);
+            ++i;
+        }
+
+        CHECK(i == list.size());
+    }
+
     SECTION("Should be by ref") {
         std::size_t i = 0;
         for (auto tup : lz::zip(a, b, c)) {
@@ -86,6 +99,11 @@ TEST_CASE("Zip binary operations", "[Zip][Binary ops]") {
         std::array<short, 3> shortest = {1, 2, 3};
         auto zip = lz::zip(c, shortest);
         CHECK(std::distance(zip.begin(), zip.end()) == 3);
+        CHECK(std::distance(zip.end(), zip.begin()) == -3);
+
+        std::vector<int> empty;
+        auto emptyZip = lz::zip(a, empty);
+        CHECK(emptyZip.begin() == emptyZip.end());
     }
 
     SECTION("Operator[]()") {
@@ -137,6 +155,19 @@ TEST_CASE("Zip to containers", "[Zip][To container]") {
         }
     }
 
+    SECTION("To columns") {
+        std::tuple<std::vector<int>, std::vector<float>, std::vector<short>> columns = lz::zip(a, b, c).toColumns();
+
+        CHECK(std::get<0>(columns) == a);
+        CHECK(std::get<1>(columns) == b);
+        CHECK(std::get<2>(columns) == std::vector<short>(c.begin(), c.end()));
+
+        std::list<int> list = {1, 2};
+        std::tuple<std::vector<int>, std::vector<int>> listColumns = lz::zip(list, a).toColumns();
+        CHECK(std::get<0>(listColumns) == std::vector<int>{1, 2});
+        CHECK(std::get<1>(listColumns) == std::vector<int>{1, 2});
+    }
+
     SECTION("To other container using to<>()") {
         auto list = lz::zip(a, b, c).to<std::list>();
         auto listIterator = list.begin();
@@ -189,3 +220,13 @@ TEST_CASE("Zip to containers", "[Zip][To container]") {
         CHECK(actual == expected);
     }
 }
+
+#ifdef LZ_HAS_CXX_20
+TEST_CASE("Zip in constant expressions", "[Zip][Constexpr]") {
+    static constexpr std::array<int, 3> a = {1, 2, 3};
+    static constexpr std::array<int, 4> b = {4, 5, 6, 7};
+    constexpr std::array<std::tuple<int, int>, 3> zipped = lz::zip(a, b).toArray<3>();
+    static_assert(std::get<0>(zipped[2]) == 3 && std::get<1>(zipped[2]) == 6, "zip should be usable in constant expressions");
+    CHECK(zipped[0] == std::make_tuple(1, 4));
+}
+#endif